@@ -9,17 +9,40 @@
 #include <cctype>
 #include <sstream>
 #include <stack> 
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <deque>
 
 
 using namespace std;
 
 // Utility function to remove comments from Verilog code (Helper Function For latch Inference)
+// Scans linearly instead of using regex so huge block comments cannot exhaust the regex engine's stack
 string removeComments(const string& code) {
-    string cleanedCode = code;
-    // Remove single-line comments (//)
-    cleanedCode = regex_replace(cleanedCode, regex(R"(//.*)"), "");
-    // Remove block comments (/* ... */)
-    cleanedCode = regex_replace(cleanedCode, regex(R"(/\*[\s\S]*?\*/)"), "");
+    string cleanedCode;
+    cleanedCode.reserve(code.size());
+    size_t i = 0;
+    while (i < code.size()) {
+        // Remove single-line comments (//) up to, but not including, the newline
+        if (code[i] == '/' && i + 1 < code.size() && code[i + 1] == '/') {
+            while (i < code.size() && code[i] != '\n') {
+                ++i;
+            }
+        }
+        // Remove block comments (/* ... */)
+        else if (code[i] == '/' && i + 1 < code.size() && code[i + 1] == '*') {
+            size_t close = code.find("*/", i + 2);
+            i = (close == string::npos) ? code.size() : close + 2;
+        }
+        else {
+            cleanedCode += code[i++];
+        }
+    }
     return cleanedCode;
 }
 
@@ -30,36 +53,421 @@ struct Violation {
     int line;
 };
 
+// Resource limits applied to every rule the StaticChecker runs (0 disables a limit)
+struct RuleBudget {
+    long long maxRuleMillis = 10000;   // Wall time one rule may spend on one file
+    long long maxFileMillis = 60000;   // Wall time all rules together may spend on one file
+    size_t maxRuleSteps = 0;           // Lines/blocks one rule may visit on one file
+    size_t maxFileSteps = 0;           // Lines/blocks all rules together may visit on one file
+    size_t maxSubjectBytes = 16384;    // Largest text one rule may hand to std::regex in a single call
+    size_t maxRecursionDepth = 20000;  // Deepest recursion one rule may use (bounds stack memory)
+};
+
+// Thrown from StaticChecker::consume to cancel the running rule; violations found so far are kept
+struct RuleAborted {
+    string reason;
+    int line;
+};
+
+// A rule that was cancelled or skipped because of its budget (reported in the summary)
+struct BudgetHit {
+    string rule;
+    string reason;
+    int line;
+};
+
+// Reads a whole file into memory in one go
+string readSourceFile(const string& filename) {
+    ifstream file(filename, ios::binary);
+    if (!file.is_open()) {
+        cerr << "Error: Unable to open file " << filename << endl;
+        exit(EXIT_FAILURE);
+    }
+    file.seekg(0, ios::end);
+    string contents(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0, ios::beg);
+    file.read(&contents[0], static_cast<streamsize>(contents.size()));
+    file.close();
+    return contents;
+}
+
 // Tokenizer for Verilog
 class VerilogParser {
 private:
-    vector<string> lines;
+    string source;
+    mutable vector<string> lines;  // Split from source on first use; netlist mode never needs them
 
 public:
-    explicit VerilogParser(const string& filename) {
-        ifstream file(filename);
-        if (!file.is_open()) {
-            cerr << "Error: Unable to open file " << filename << endl;
-            exit(EXIT_FAILURE);
-        }
-        string line;
-        while (getline(file, line)) {
-            lines.push_back(line);
-        }
-        file.close();
+    explicit VerilogParser(const string& filename) : source(readSourceFile(filename)) {}
+
+    const string& getSource() const {
+        return source;
+    }
+
+    // Hands the source buffer over to a longer-lived owner; getSource() is empty afterwards
+    string releaseSource() {
+        lines.clear();
+        return move(source);
     }
 
     const vector<string>& getLines() const {
+        if (lines.empty() && !source.empty()) {
+            istringstream stream(source);
+            string line;
+            while (getline(stream, line)) {
+                // The file is read in binary mode, so drop the '\r' of CRLF endings that text mode used to strip
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                lines.push_back(line);
+            }
+        }
         return lines;
     }
 };
 
+// Non-owning view of part of a source buffer, so the structural parser can work without allocating per token
+struct TextSpan {
+    const char* data = nullptr;
+    size_t size = 0;
+
+    TextSpan() = default;
+    TextSpan(const char* data, size_t size) : data(data), size(size) {}
+
+    bool operator==(const TextSpan& other) const {
+        return size == other.size && memcmp(data, other.data, size) == 0;
+    }
+
+    template <size_t N>
+    bool equals(const char (&text)[N]) const {
+        return N - 1 == size && memcmp(data, text, N - 1) == 0;
+    }
+
+    bool equals(const string& text) const {
+        return text.size() == size && memcmp(data, text.data(), size) == 0;
+    }
+
+    string str() const {
+        return string(data, size);
+    }
+};
+
+// Multiplicative hash over the span, eight bytes at a time (net names are short, so this beats byte-wise FNV)
+struct TextSpanHash {
+    size_t operator()(const TextSpan& span) const {
+        uint64_t hash = 0x9E3779B97F4A7C15ULL ^ span.size;
+        size_t i = 0;
+        for (; i + 8 <= span.size; i += 8) {
+            uint64_t word;
+            memcpy(&word, span.data + i, 8);
+            hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+            hash ^= hash >> 32;
+        }
+        uint64_t tail = 0;
+        memcpy(&tail, span.data + i, span.size - i);
+        hash = (hash ^ tail) * 0xC4CEB9FE1A85EC53ULL;
+        return static_cast<size_t>(hash ^ (hash >> 29));
+    }
+};
+
+enum class TokenKind { Identifier, Number, String, Symbol, End };
+
+struct Token {
+    TokenKind kind;
+    TextSpan text;
+    int line;
+
+    template <size_t N>
+    bool is(const char (&text)[N]) const {
+        return kind != TokenKind::End && kind != TokenKind::String && this->text.equals(text);
+    }
+};
+
+// Allocation-free lexer over an in-memory buffer: skips whitespace, comments, compiler directives and
+// (* attributes *), and returns identifiers, (sized) numbers, strings and operators as spans into the buffer.
+// It also tokenizes the Liberty and JSON cell libraries.
+class VerilogLexer {
+private:
+    const char* cursor;
+    const char* end;
+    int line = 1;
+    Token lookahead;
+    bool hasLookahead = false;
+
+    static bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    static bool isIdentifierStart(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$';
+    }
+
+    static bool isIdentifierChar(char c) {
+        return isIdentifierStart(c) || isDigit(c);
+    }
+
+    static bool isBaseChar(char c) {
+        return strchr("bBoOdDhH", c) != nullptr && c != '\0';
+    }
+
+    void skipTrivia() {
+        while (cursor < end) {
+            char c = *cursor;
+            if (c == '\n') {
+                ++line;
+                ++cursor;
+            }
+            else if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+                ++cursor;
+            }
+            else if (c == '/' && cursor + 1 < end && cursor[1] == '/') {
+                while (cursor < end && *cursor != '\n') {
+                    ++cursor;
+                }
+            }
+            else if ((c == '/' && cursor + 1 < end && cursor[1] == '*') ||
+                     (c == '(' && cursor + 2 < end && cursor[1] == '*' && cursor[2] != ')')) {
+                // Block comment or attribute; both run to the next "*/" or "*)"
+                char closer = (c == '/') ? '/' : ')';
+                cursor += 2;
+                while (cursor < end && !(*cursor == '*' && cursor + 1 < end && cursor[1] == closer)) {
+                    if (*cursor == '\n') {
+                        ++line;
+                    }
+                    ++cursor;
+                }
+                cursor = (cursor < end) ? cursor + 2 : end;
+            }
+            else if (c == '`') {
+                // Compiler directive such as `timescale or `define: ignore the rest of the line
+                while (cursor < end && *cursor != '\n') {
+                    ++cursor;
+                }
+            }
+            else {
+                return;
+            }
+        }
+    }
+
+    // Consumes the "'b0101" part of a based number, with the optional sign flag and spaces allowed by Verilog
+    bool consumeBase() {
+        const char* probe = cursor;
+        while (probe < end && (*probe == ' ' || *probe == '\t')) {
+            ++probe;
+        }
+        if (probe >= end || *probe != '\'') {
+            return false;
+        }
+        ++probe;
+        if (probe < end && (*probe == 's' || *probe == 'S')) {
+            ++probe;
+        }
+        if (probe >= end || !isBaseChar(*probe)) {
+            return false;
+        }
+        ++probe;
+        while (probe < end && (*probe == ' ' || *probe == '\t')) {
+            ++probe;
+        }
+        while (probe < end && (isalnum(static_cast<unsigned char>(*probe)) || *probe == '_' || *probe == '?')) {
+            ++probe;
+        }
+        cursor = probe;
+        return true;
+    }
+
+    Token lex() {
+        skipTrivia();
+        if (cursor >= end) {
+            return { TokenKind::End, TextSpan(end, 0), line };
+        }
+
+        const char* start = cursor;
+        char c = *cursor;
+        if (isIdentifierStart(c)) {
+            while (cursor < end && isIdentifierChar(*cursor)) {
+                ++cursor;
+            }
+            return { TokenKind::Identifier, TextSpan(start, cursor - start), line };
+        }
+        if (c == '\\') {
+            // Escaped identifier: everything up to the next whitespace
+            while (cursor < end && !isspace(static_cast<unsigned char>(*cursor))) {
+                ++cursor;
+            }
+            return { TokenKind::Identifier, TextSpan(start, cursor - start), line };
+        }
+        if (isDigit(c)) {
+            while (cursor < end && (isDigit(*cursor) || *cursor == '_')) {
+                ++cursor;
+            }
+            if (!consumeBase() && cursor + 1 < end && *cursor == '.' && isDigit(cursor[1])) {
+                ++cursor;
+                while (cursor < end && (isalnum(static_cast<unsigned char>(*cursor)) || *cursor == '-' || *cursor == '+')) {
+                    ++cursor;
+                }
+            }
+            return { TokenKind::Number, TextSpan(start, cursor - start), line };
+        }
+        if (c == '\'' && consumeBase()) {
+            return { TokenKind::Number, TextSpan(start, cursor - start), line };
+        }
+        if (c == '"') {
+            ++cursor;
+            while (cursor < end && *cursor != '"') {
+                if (*cursor == '\\' && cursor + 1 < end) {
+                    ++cursor;
+                }
+                if (*cursor == '\n') {
+                    ++line;
+                }
+                ++cursor;
+            }
+            cursor = (cursor < end) ? cursor + 1 : end;
+            return { TokenKind::String, TextSpan(start + 1, (cursor - start) >= 2 ? cursor - start - 2 : 0), line };
+        }
+
+        // Punctuation that is never the start of a longer operator is by far the most common in netlists
+        if (strchr(".,;()[]{}#@:?", c) == nullptr) {
+            static const char* const multiCharOperators[] = {
+                "===", "!==", "<<<", ">>>", "==", "!=", "<=", ">=", "&&", "||", "<<", ">>",
+                "~&", "~|", "~^", "^~", "**", "->", "+:", "-:"
+            };
+            for (const char* op : multiCharOperators) {
+                size_t length = strlen(op);
+                if (op[0] == c && static_cast<size_t>(end - cursor) >= length && memcmp(cursor, op, length) == 0) {
+                    cursor += length;
+                    return { TokenKind::Symbol, TextSpan(start, length), line };
+                }
+            }
+        }
+        ++cursor;
+        return { TokenKind::Symbol, TextSpan(start, 1), line };
+    }
+
+public:
+    VerilogLexer(const char* begin, const char* end) : cursor(begin), end(end) {}
+
+    Token next() {
+        if (hasLookahead) {
+            hasLookahead = false;
+            return lookahead;
+        }
+        return lex();
+    }
+
+    const Token& peek() {
+        if (!hasLookahead) {
+            lookahead = lex();
+            hasLookahead = true;
+        }
+        return lookahead;
+    }
+
+    // Consumes a bracketed group whose opening token has already been read, e.g. "#( ... )" or "[7:0]"
+    template <size_t N, size_t M>
+    void skipBalanced(const char (&open)[N], const char (&close)[M]) {
+        int depth = 1;
+        while (depth > 0) {
+            Token token = next();
+            if (token.kind == TokenKind::End) {
+                return;
+            }
+            if (token.is(open)) {
+                ++depth;
+            }
+            else if (token.is(close)) {
+                --depth;
+            }
+        }
+    }
+
+    // Consumes tokens up to and including the next ';'
+    void skipStatement() {
+        for (Token token = next(); token.kind != TokenKind::End && !token.is(";"); token = next()) {
+        }
+    }
+};
+
 // Static Checker Engine
 class StaticChecker {
 private:
     vector<string> lines;
     vector<Violation> violations;
 
+    // Budget bookkeeping for the rule currently running
+    RuleBudget budget;
+    vector<BudgetHit> budgetHits;
+    string currentRule;
+    chrono::steady_clock::time_point fileStart;
+    chrono::steady_clock::time_point ruleStart;
+    size_t ruleSteps = 0;
+    size_t fileSteps = 0;
+
+    static long long elapsedMillis(chrono::steady_clock::time_point since) {
+        return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - since).count();
+    }
+
+    // Cooperative cancellation point: every rule calls this before handing a line or block to the regex engine.
+    // Throws RuleAborted when the running rule is over its step, time or subject size budget.
+    void consume(const string& subject, int line) {
+        ++ruleSteps;
+        ++fileSteps;
+        if (budget.maxSubjectBytes > 0 && subject.size() > budget.maxSubjectBytes) {
+            throw RuleAborted{ "input of " + to_string(subject.size()) + " bytes exceeds the " +
+                to_string(budget.maxSubjectBytes) + " byte budget", line };
+        }
+        if (budget.maxRuleSteps > 0 && ruleSteps > budget.maxRuleSteps) {
+            throw RuleAborted{ "step budget of " + to_string(budget.maxRuleSteps) + " exhausted", line };
+        }
+        if (budget.maxFileSteps > 0 && fileSteps > budget.maxFileSteps) {
+            throw RuleAborted{ "file step budget of " + to_string(budget.maxFileSteps) + " exhausted", line };
+        }
+        if (budget.maxRuleMillis > 0 && elapsedMillis(ruleStart) > budget.maxRuleMillis) {
+            throw RuleAborted{ "time budget of " + to_string(budget.maxRuleMillis) + " ms exhausted", line };
+        }
+        if (budget.maxFileMillis > 0 && elapsedMillis(fileStart) > budget.maxFileMillis) {
+            throw RuleAborted{ "file time budget of " + to_string(budget.maxFileMillis) + " ms exhausted", line };
+        }
+    }
+
+    void recordAbort(const string& rule, const string& reason, int line) {
+        violations.push_back({ "Rule aborted (" + rule + "): " + reason, line });
+        budgetHits.push_back({ rule, reason, line });
+    }
+
+    // Records input a rule left out because of its budget while the rule itself carries on
+    void recordSkip(const string& reason, int line) {
+        budgetHits.push_back({ currentRule, reason, line });
+    }
+
+    // Runs one rule under the budget; an aborted rule keeps the violations it already reported
+    void runRule(const string& name, void (StaticChecker::*rule)()) {
+        if (budget.maxFileMillis > 0 && elapsedMillis(fileStart) > budget.maxFileMillis) {
+            recordAbort(name, "skipped, file time budget of " + to_string(budget.maxFileMillis) + " ms exhausted", 0);
+            return;
+        }
+        if (budget.maxFileSteps > 0 && fileSteps >= budget.maxFileSteps) {
+            recordAbort(name, "skipped, file step budget of " + to_string(budget.maxFileSteps) + " exhausted", 0);
+            return;
+        }
+
+        currentRule = name;
+        ruleStart = chrono::steady_clock::now();
+        ruleSteps = 0;
+        try {
+            (this->*rule)();
+        }
+        catch (const RuleAborted& abort) {
+            recordAbort(name, abort.reason, abort.line);
+        }
+        catch (const regex_error& error) {
+            // Some regex engines report runaway backtracking as an exception instead of overflowing the stack
+            recordAbort(name, string("regex engine gave up: ") + error.what(), 0);
+        }
+    }
+
     // UnreachableFSM Checks
     void checkUnreachableFSMStates() {
         unordered_set<string> availableStates;                      // States defined in the case block
@@ -73,6 +481,7 @@ private:
         for (size_t i = 0; i < lines.size(); ++i) {
             string line = lines[i];
             smatch match;
+            consume(line, static_cast<int>(i + 1));
 
             // Parse states in the case block
             if (regex_search(line, match, stateRegex)) {
@@ -105,6 +514,23 @@ private:
     }
 
 
+    // Hand-written check for the "always\s*@\*\s*begin" prefix of the latch regex
+    static bool startsCombinationalBlock(const string& code, size_t position) {
+        size_t i = position + 6;  // After "always"
+        auto skipSpace = [&]() {
+            while (i < code.size() && isspace(static_cast<unsigned char>(code[i]))) {
+                ++i;
+            }
+        };
+        skipSpace();
+        if (code.compare(i, 2, "@*") != 0) {
+            return false;
+        }
+        i += 2;
+        skipSpace();
+        return code.compare(i, 5, "begin") == 0;
+    }
+
     // Check Latch Inference
     void checkLatchInference() {
         string verilogCode;
@@ -120,12 +546,35 @@ private:
         smatch alwaysBlockMatch;
         vector<string> alwaysBlocks;
 
-        // Extract all always blocks
-        auto codeBegin = verilogCode.cbegin();
-        auto codeEnd = verilogCode.cend();
-        while (regex_search(codeBegin, codeEnd, alwaysBlockMatch, alwaysBlockRegex)) {
-            alwaysBlocks.push_back(alwaysBlockMatch[1].str());
-            codeBegin = alwaysBlockMatch.suffix().first;
+        // Extract all always blocks, searching one block at a time so a single regex call never sees more
+        // than one block of text. The lazy match can only end at the first "end" after its "always", so
+        // each chunk stops there (or at the next "always", whichever comes first).
+        // Only chunks starting with "always @* begin" can match, which is checked by hand first so that
+        // clocked blocks never reach the regex engine; an oversized combinational block is skipped (and
+        // listed in the budget summary) without cancelling the rest of the rule.
+        static const string noSubject;
+        size_t chunkStart = verilogCode.find("always");
+        while (chunkStart != string::npos) {
+            size_t nextAlways = verilogCode.find("always", chunkStart + 1);
+            consume(noSubject, 0);
+            if (!startsCombinationalBlock(verilogCode, chunkStart)) {
+                chunkStart = nextAlways;
+                continue;
+            }
+            size_t firstEnd = verilogCode.find("end", chunkStart);
+            size_t chunkEnd = firstEnd == string::npos ? nextAlways : min(nextAlways, firstEnd + 3);
+            size_t chunkSize = (chunkEnd == string::npos ? verilogCode.size() : chunkEnd) - chunkStart;
+            if (budget.maxSubjectBytes > 0 && chunkSize > budget.maxSubjectBytes) {
+                recordSkip("always @* block of " + to_string(chunkSize) + " bytes exceeds the " +
+                    to_string(budget.maxSubjectBytes) + " byte budget; block skipped", 0);
+                chunkStart = nextAlways;
+                continue;
+            }
+            string chunk = verilogCode.substr(chunkStart, chunkSize);
+            if (regex_search(chunk, alwaysBlockMatch, alwaysBlockRegex)) {
+                alwaysBlocks.push_back(alwaysBlockMatch[1].str());
+            }
+            chunkStart = nextAlways;
         }
 
         // Process each always block
@@ -143,6 +592,7 @@ private:
 
             while (getline(blockStream, currentLine)) {
                 ++lineNumber;
+                consume(currentLine, lineNumber);
 
                 // Remove leading/trailing whitespace for cleaner processing
                 currentLine = regex_replace(currentLine, regex(R"(^\s+|\s+$)"), "");
@@ -223,6 +673,7 @@ private:
         for (int i = 0; i < lines.size(); ++i) {
             string line = lines[i];
             smatch match;
+            consume(line, i + 1);
 
             // Capture all declared registers and their line numbers
             if (regex_search(line, match, regPattern)) {
@@ -272,6 +723,7 @@ private:
 
         for (size_t lineNum = 0; lineNum < lines.size(); ++lineNum) {
             string line = lines[lineNum];
+            consume(line, static_cast<int>(lineNum + 1));
 
             // Remove comments from the line
             line = removeComments(line);
@@ -334,6 +786,7 @@ private:
         for (int i = 0; i < lines.size(); ++i) {
             string line = lines[i];
             smatch match;
+            consume(line, i + 1);
 
             // Check for assign statements
             if (regex_search(line, match, assignPattern)) {
@@ -371,6 +824,12 @@ private:
                 return false;
             }
 
+            consume(node, lineMap.count(node) ? lineMap[node] : 0);
+            if (budget.maxRecursionDepth > 0 && recursionStack.size() >= budget.maxRecursionDepth) {
+                throw RuleAborted{ "recursion depth budget of " + to_string(budget.maxRecursionDepth) + " exhausted",
+                    lineMap.count(node) ? lineMap[node] : 0 };
+            }
+
             // Mark the node as visited and add to recursion stack
             visited.insert(node);
             recursionStack.insert(node);
@@ -413,6 +872,7 @@ private:
         for (int i = 0; i < lines.size(); ++i) {
             string line = lines[i];
             smatch match;
+            consume(line, i + 1);
 
             // Detect the start of a case statement
             if (regex_search(line, match, casePattern)) {
@@ -423,6 +883,7 @@ private:
                 // Traverse lines to find the end of the case block
                 while (++i < lines.size()) {
                     line = lines[i];
+                    consume(line, i + 1);
                     // Check for `default` case
                     if (regex_search(line, defaultPattern)) {
                         hasDefault = true;
@@ -452,83 +913,8 @@ private:
         }
     }
 
-    // Function to detect unreachable branches
-    void checkDeadCode() {
-        regex regRegex(R"(\s*reg\s*\[\s*(\d+)\s*:\s*0\s*\]\s*([a-zA-Z_][a-zA-Z0-9_]*)\s*;)");
-        regex caseRegex(R"(\s*case\s*\(\s*([a-zA-Z_][a-zA-Z0-9_]*)\s*\))");
-        regex caseBranchRegex(R"(\s*(\d+'b[01]+)\s*:.*)");
-        regex ifElseRegex(R"(\s*(if|else if|else)\s*\(?\s*.*?\)?\s*([a-zA-Z_][a-zA-Z0-9_]*)\s*=\s*(\d+'b[01]+)\s*;)");
-        regex ifConditionRegex(R"(\s*(if|else if)\s*\(\s*(.*?)\s*\))"); // To match if and else if conditions
-
-        string currentSelector;
-        unordered_set<string> reachableValues; // Track reachable values
-        vector<pair<string, size_t>> caseBranches; // Values from case statement with line numbers
-        bool inCaseBlock = false;
-        unordered_set<int> unreachableIfElseLines; // To track unreachable if-else lines
-
-        for (size_t lineNumber = 0; lineNumber < lines.size(); ++lineNumber) {
-            string line = lines[lineNumber];
-            smatch match;
-
-            // Detect register declaration
-            if (regex_search(line, match, regRegex)) {
-                currentSelector = match[2];
-            }
-
-            // Track assignments to the selector variable
-            if (regex_search(line, match, ifElseRegex)) {
-                if (match[2] == currentSelector) {
-                    reachableValues.insert(match[3]); // Add assigned value
-                }
-            }
-
-            // Start analyzing a case block
-            if (regex_search(line, match, caseRegex)) {
-                if (match[1] == currentSelector) {
-                    inCaseBlock = true;
-                    caseBranches.clear();
-                }
-            }
-
-            // Collect values in case branches with line numbers
-            if (inCaseBlock && regex_search(line, match, caseBranchRegex)) {
-                caseBranches.emplace_back(match[1], lineNumber + 1);
-            }
-
-            // End of case block
-            if (inCaseBlock && line.find("endcase") != string::npos) {
-                inCaseBlock = false;
-
-                // Compare reachable values with case branches
-                unordered_set<size_t> unreachableBranchLines;
-                for (const auto& branch : caseBranches) {
-                    if (reachableValues.find(branch.first) == reachableValues.end()) {
-                        unreachableBranchLines.insert(branch.second);
-                    }
-                }
-
-                // Report unreachable branches with line numbers
-                for (const auto& branchLine : unreachableBranchLines) {
-                    violations.push_back({ "Unreachable 'case' branch at line: " + to_string(branchLine), static_cast<int>(branchLine) });
-                }
-            }
-
-            // Check for unreachable if-else conditions
-            if (regex_search(line, match, ifConditionRegex)) {
-                string condition = match[2];
-
-                // For simplicity, assume conditions that are always false (simplified analysis)
-                if (condition == "1'b0" || condition == "0") { // Example: Always false condition
-                    unreachableIfElseLines.insert(lineNumber + 1); // Mark this line as unreachable
-                }
-            }
-        }
-
-        // Report unreachable if-else branches
-        for (const auto& line : unreachableIfElseLines) {
-            violations.push_back({ "Unreachable if-else statement at line: " + to_string(line), line });
-        }
-    }
+    // Function to detect unreachable branches (constant propagation; defined after the RTL model it runs on)
+    void checkDeadCode();
 
     // Arithmetic Overflow Checks
     void checkArithmeticOverflow() {
@@ -545,8 +931,10 @@ private:
         unordered_map<string, int> variableBitWidths; // Map to store bit widths for variables
 
         // Step 1: Extract bit widths from variable declarations
-        for (const string& line : lines) {
+        for (size_t i = 0; i < lines.size(); ++i) {
+            const string& line = lines[i];
             smatch match;
+            consume(line, static_cast<int>(i + 1));
             if (regex_search(line, match, declarationPattern)) {
                 int msb = stoi(match[1]); // Extract most significant bit
                 int lsb = stoi(match[2]); // Extract least significant bit
@@ -595,6 +983,7 @@ private:
         for (size_t i = 0; i < lines.size(); ++i) {
             string line = lines[i];
             smatch match;
+            consume(line, static_cast<int>(i + 1));
 
             // Detect assignment statements
             if (regex_search(line, match, assignmentPattern)) {
@@ -669,6 +1058,7 @@ private:
         for (size_t i = 0; i < lines.size(); ++i) {
             string line = lines[i];
             smatch match;
+            consume(line, static_cast<int>(i + 1));
 
             // Search for 'assign' statements
             if (regex_search(line, match, assignPattern)) {
@@ -688,21 +1078,28 @@ private:
 
 
 public:
-    explicit StaticChecker(const vector<string>& lines) : lines(lines) {}
+    explicit StaticChecker(const vector<string>& lines, const RuleBudget& budget = RuleBudget())
+        : lines(lines), budget(budget) {}
 
     void runChecks() {
-        checkUnreachableFSMStates();
-        checkUninitializedRegisters();
-        checkLatchInference();
-        checkXPropagation();
-        checkCombinationalLoops();
-        checkCaseStatements();
-        checkDeadCode();
-        checkArithmeticOverflow();
-        checkMultiDrivenBus();
+        fileStart = chrono::steady_clock::now();
+        fileSteps = 0;
+        runRule("UnreachableFSMStates", &StaticChecker::checkUnreachableFSMStates);
+        runRule("UninitializedRegisters", &StaticChecker::checkUninitializedRegisters);
+        runRule("LatchInference", &StaticChecker::checkLatchInference);
+        runRule("XPropagation", &StaticChecker::checkXPropagation);
+        runRule("CombinationalLoops", &StaticChecker::checkCombinationalLoops);
+        runRule("CaseStatements", &StaticChecker::checkCaseStatements);
+        runRule("DeadCode", &StaticChecker::checkDeadCode);
+        runRule("ArithmeticOverflow", &StaticChecker::checkArithmeticOverflow);
+        runRule("MultiDrivenBus", &StaticChecker::checkMultiDrivenBus);
 
     }
 
+    const vector<BudgetHit>& getBudgetHits() const {
+        return budgetHits;
+    }
+
     void reportViolations() const {
         if (violations.empty()) {
             cout << "No violations found!" << endl;
@@ -716,24 +1113,3604 @@ public:
     }
 };
 
-// Main Program
-int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        cerr << "Usage: " << argv[0] << " <verilog_file>" << endl;
-        return EXIT_FAILURE;
+// Direction of a cell pin or module port
+enum class PinDirection { Input, Output, Inout, Unknown };
+
+struct CellPin {
+    string name;
+    PinDirection direction;
+};
+
+// Pin directions of one library cell (or of a module defined earlier in the netlist)
+struct CellDefinition {
+    vector<CellPin> pins;      // In declaration order, which is also the positional connection order
+    bool sequential = false;   // Clocked or opaque cells break combinational paths
+
+    int findPin(const TextSpan& name) const {
+        for (size_t i = 0; i < pins.size(); ++i) {
+            if (name.equals(pins[i].name)) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    void setPin(const string& name, PinDirection direction) {
+        for (auto& pin : pins) {
+            if (pin.name == name) {
+                pin.direction = direction;
+                return;
+            }
+        }
+        pins.push_back({ name, direction });
     }
+};
 
-    string filename = argv[1];
+// Cell direction library loaded from a Liberty subset (cell/pin groups, direction and clock attributes,
+// ff/latch groups) or from a JSON pin map such as {"AND2X1": {"A": "input", "B": "input", "Y": "output"}}.
+// In the JSON form a pin direction of "clock" marks the cell as sequential.
+class CellLibrary {
+private:
+    unordered_map<string, CellDefinition> cells;
+
+    static PinDirection parseDirection(const string& text, bool& isClock) {
+        isClock = (text == "clock");
+        if (text == "input" || isClock) {
+            return PinDirection::Input;
+        }
+        if (text == "output") {
+            return PinDirection::Output;
+        }
+        if (text == "inout") {
+            return PinDirection::Inout;
+        }
+        return PinDirection::Unknown;
+    }
 
-    // Parse Verilog File
-    VerilogParser parser(filename);
+    void loadJson(const string& contents) {
+        VerilogLexer lexer(contents.data(), contents.data() + contents.size());
+        if (!lexer.next().is("{")) {
+            return;
+        }
+        for (Token cellName = lexer.next(); cellName.kind == TokenKind::String; cellName = lexer.next()) {
+            CellDefinition& cell = cells[cellName.text.str()];
+            if (!lexer.next().is(":") || !lexer.next().is("{")) {
+                return;
+            }
+            for (Token pinName = lexer.next(); pinName.kind == TokenKind::String; pinName = lexer.next()) {
+                lexer.next();  // ':'
+                bool isClock = false;
+                cell.setPin(pinName.text.str(), parseDirection(lexer.next().text.str(), isClock));
+                cell.sequential = cell.sequential || isClock;
+                if (!lexer.peek().is(",")) {
+                    break;
+                }
+                lexer.next();
+            }
+            lexer.next();  // '}'
+            if (!lexer.peek().is(",")) {
+                break;
+            }
+            lexer.next();
+        }
+    }
 
-    // Perform Static Checks
-    StaticChecker checker(parser.getLines());
-    checker.runChecks();
+    void loadLiberty(const string& contents) {
+        VerilogLexer lexer(contents.data(), contents.data() + contents.size());
+        vector<string> groups;                 // Enclosing group kinds, e.g. library > cell > pin
+        CellDefinition* cell = nullptr;
+        vector<string> currentPins;
 
-    // Report Violations
-    checker.reportViolations();
+        for (Token token = lexer.next(); token.kind != TokenKind::End; token = lexer.next()) {
+            if (token.is("}")) {
+                if (!groups.empty()) {
+                    if (groups.back() == "cell") {
+                        cell = nullptr;
+                    }
+                    else if (groups.back() == "pin") {
+                        currentPins.clear();
+                    }
+                    groups.pop_back();
+                }
+                continue;
+            }
+            if (token.kind != TokenKind::Identifier) {
+                continue;
+            }
 
-    return 0;
-}
\ No newline at end of file
+            string name = token.text.str();
+            if (lexer.peek().is("(")) {
+                // Group header or complex attribute: name ( args ) followed by '{' or ';'
+                lexer.next();
+                vector<string> args;
+                for (Token arg = lexer.next(); arg.kind != TokenKind::End && !arg.is(")"); arg = lexer.next()) {
+                    if (arg.kind != TokenKind::Symbol) {
+                        args.push_back(arg.text.str());
+                    }
+                }
+                if (!lexer.peek().is("{")) {
+                    continue;
+                }
+                lexer.next();
+                groups.push_back(name);
+                if (name == "cell" && !args.empty()) {
+                    cell = &cells[args[0]];
+                }
+                else if (name == "pin" && cell) {
+                    currentPins = args;
+                    for (const auto& pin : args) {
+                        cell->setPin(pin, PinDirection::Unknown);
+                    }
+                }
+                else if (cell && (name == "ff" || name == "latch" || name == "ff_bank" || name == "latch_bank" ||
+                                  name == "statetable")) {
+                    cell->sequential = true;
+                }
+            }
+            else if (lexer.peek().is(":")) {
+                // Simple attribute: name : value ;
+                lexer.next();
+                string value = lexer.next().text.str();
+                if (cell && !currentPins.empty() && name == "direction") {
+                    bool isClock = false;
+                    PinDirection direction = parseDirection(value, isClock);
+                    for (const auto& pin : currentPins) {
+                        cell->setPin(pin, direction);
+                    }
+                }
+                else if (cell && !currentPins.empty() && name == "clock" && value == "true") {
+                    cell->sequential = true;
+                }
+            }
+        }
+    }
+
+public:
+    // Loads a library file; files ending in .json are read as pin maps, anything else as Liberty
+    void load(const string& filename) {
+        string contents = readSourceFile(filename);
+        bool isJson = filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".json") == 0;
+        size_t before = cells.size();
+        if (isJson) {
+            loadJson(contents);
+        }
+        else {
+            loadLiberty(contents);
+        }
+        if (cells.size() == before) {
+            cerr << "Warning: no cells found in cell library " << filename << endl;
+        }
+    }
+
+    const CellDefinition* find(const string& name) const {
+        auto it = cells.find(name);
+        return it == cells.end() ? nullptr : &it->second;
+    }
+};
+
+// Netlist detection on a sample of about a megabyte of statements, or the first 10000 instances. Module
+// headers and net/port declarations are skipped without counting against the sample, since synthesized
+// netlists list every net before the first instance. Ordinary RTL wrappers are also made of assigns and named port
+// connections, so this asks for positive evidence: no behavioral blocks, assign right-hand sides that are
+// plain nets or constants, and most instances resolving to cells of the loaded library. Instances of modules
+// defined in the same sample (hierarchical netlists) and gate primitives count for neither side. Without a
+// cell library nothing resolves, so the file stays in RTL mode unless --netlist is given.
+bool looksLikeNetlist(const string& source, const CellLibrary& library) {
+    const size_t sampleBytes = 1 << 20;
+    const size_t sampleInstances = 10000;
+    VerilogLexer lexer(source.data(), source.data() + source.size());
+    unordered_set<string> definedModules;
+    unordered_map<string, size_t> unresolvedTypes;  // Instance counts of types not in the library
+    size_t libraryInstances = 0;
+    size_t unresolvedInstances = 0;
+    size_t declarationBytes = 0;  // Bytes of skipped headers and declarations
+    bool statementStart = true;
+
+    for (Token token = lexer.next(); token.kind != TokenKind::End; token = lexer.next()) {
+        const size_t offset = static_cast<size_t>(token.text.data - source.data());
+        if (offset - declarationBytes > sampleBytes || libraryInstances + unresolvedInstances >= sampleInstances) {
+            break;
+        }
+        if (token.is("always") || token.is("initial") || token.is("function") || token.is("task")) {
+            return false;
+        }
+        if (token.is(";") || token.is("endmodule")) {
+            statementStart = true;
+            continue;
+        }
+        if (!statementStart) {
+            continue;
+        }
+        statementStart = false;
+
+        if (token.is("module") || token.is("macromodule")) {
+            definedModules.insert(lexer.next().text.str());
+            lexer.skipStatement();
+            declarationBytes += static_cast<size_t>(lexer.peek().text.data - token.text.data);
+            statementStart = true;
+        }
+        else if (token.is("wire") || token.is("reg") || token.is("logic") || token.is("tri") || token.is("wand") ||
+                 token.is("wor") || token.is("input") || token.is("output") || token.is("inout") ||
+                 token.is("supply0") || token.is("supply1")) {
+            lexer.skipStatement();
+            declarationBytes += static_cast<size_t>(lexer.peek().text.data - token.text.data);
+            statementStart = true;
+        }
+        else if (token.is("assign")) {
+            // Anything beyond nets, selects, concatenations and constants is an RTL expression
+            for (Token rhs = lexer.next(); rhs.kind != TokenKind::End && !rhs.is(";"); rhs = lexer.next()) {
+                if (rhs.kind == TokenKind::Symbol && !rhs.is("=") && !rhs.is("[") && !rhs.is("]") && !rhs.is(":") &&
+                    !rhs.is("{") && !rhs.is("}") && !rhs.is(",")) {
+                    return false;
+                }
+            }
+            statementStart = true;
+        }
+        else if (token.kind == TokenKind::Identifier &&
+                 (lexer.peek().is("#") || lexer.peek().kind == TokenKind::Identifier)) {
+            // TYPE [#(...)] name [range] ( ... ) is an instance; a declaration such as "input a;" has no
+            // '(' or '[' after its first name
+            const string type = token.text.str();
+            if (library.find(type)) {
+                ++libraryInstances;
+            }
+            else if (lexer.peek().is("#")) {
+                ++unresolvedTypes[type];
+                ++unresolvedInstances;
+            }
+            else {
+                lexer.next();  // Instance name, or the first name of a declaration
+                if (lexer.peek().is("(") || lexer.peek().is("[")) {
+                    ++unresolvedTypes[type];
+                    ++unresolvedInstances;
+                }
+            }
+        }
+    }
+
+    static const char* const primitives[] = {
+        "and", "or", "nand", "nor", "xor", "xnor", "not", "buf", "bufif0", "bufif1", "notif0", "notif1"
+    };
+    size_t otherInstances = 0;
+    for (const auto& type : unresolvedTypes) {
+        bool primitive = false;
+        for (const char* name : primitives) {
+            primitive = primitive || type.first == name;
+        }
+        if (!primitive && definedModules.count(type.first) == 0) {
+            otherInstances += type.second;
+        }
+    }
+    return libraryInstances > 0 && libraryInstances > otherInstances;
+}
+
+// Structural (gate-level) checker. Parses module ports, cell instances and continuous assigns straight from
+// the source buffer, builds a net-to-pin connectivity graph per module and checks it for multiple drivers,
+// floating inputs and combinational loops. None of the regex rules run in this mode.
+class NetlistChecker {
+private:
+    enum NetFlag : uint8_t { NetPortInput = 1, NetPortOutput = 2, NetPortInout = 4, NetOpaque = 8, NetSelect = 16 };
+
+    static const uint32_t kNoBus = UINT32_MAX;
+
+    struct Net {
+        TextSpan name;
+        uint32_t hash;
+        int line;              // First reference
+        int driverLine;        // Most recent driver
+        uint32_t drivers;
+        uint32_t loads;
+        uint8_t flags;
+        uint32_t bus;          // Bus this net is the whole of, or a bit/part select of (kNoBus if neither)
+        int low;               // Constant select range, -1 when the net is not a select or the range is not constant
+        int high;
+    };
+
+    // The whole-bus net "n" and its selects "n[0]", "n[3:1]", ... are separate nets in the graph; a bus
+    // records enough about the selects to relate them when drivers are checked
+    struct Bus {
+        uint32_t whole = UINT32_MAX;        // Net index of the whole-bus reference, if the module has one
+        bool selectDriven = false;          // Some select has a driver
+        bool selectOpaque = false;          // Some select is connected to an unknown or inout pin
+        bool unknownRangeDriven = false;    // Some select with a non-constant range has a driver
+        vector<pair<int, int>> drivenRanges;  // Constant (low, high) ranges of driven selects, sorted by low
+        vector<int> highPrefixMax;            // Running maximum of high over drivenRanges
+
+        bool drives(int low, int high) const {
+            if (unknownRangeDriven || (low < 0 && selectDriven)) {
+                return true;
+            }
+            // Among ranges starting at or below high, is any one reaching low?
+            size_t count = upper_bound(drivenRanges.begin(), drivenRanges.end(), make_pair(high, INT32_MAX)) - drivenRanges.begin();
+            return count > 0 && highPrefixMax[count - 1] >= low;
+        }
+    };
+
+    struct Instance {
+        TextSpan type;
+        TextSpan name;
+        int line;
+        const CellDefinition* cell;  // nullptr when the cell type is unknown
+        uint32_t firstConnection;
+        uint32_t connectionCount;
+    };
+
+    struct Connection {
+        uint32_t net;
+        uint32_t instance;
+        PinDirection direction;
+    };
+
+    const CellLibrary& library;
+    vector<Violation> violations;
+
+    // Modules defined earlier in the file become cells for the modules that instantiate them
+    unordered_map<string, CellDefinition> moduleCells;
+    unordered_map<TextSpan, const CellDefinition*, TextSpanHash> cellCache;
+    unordered_set<TextSpan, TextSpanHash> unknownCellTypes;
+    CellDefinition assignCell;  // Pseudo cell for "assign lhs = rhs": pin 0 drives, pin 1 loads
+
+    // Per-module graph, cleared between modules so the storage is reused. Nets are interned in an
+    // open-addressing table whose slots hold (hash << 32 | net index + 1), which avoids a heap node per net
+    // and lets most probes be rejected without touching the net itself.
+    vector<uint64_t> netSlots = vector<uint64_t>(1024, 0);
+    unordered_map<TextSpan, PinDirection, TextSpanHash> portDirections;
+    vector<TextSpan> portOrder;
+    vector<Net> nets;
+    vector<Bus> buses;
+    unordered_map<TextSpan, uint32_t, TextSpanHash> busIndex;
+    deque<string> normalizedNames;  // Backing store for net names rebuilt without whitespace
+    vector<Instance> instances;
+    vector<Connection> connections;
+
+    size_t moduleCount = 0;
+    size_t instanceCount = 0;
+    size_t netCount = 0;
+    size_t unknownInstanceCount = 0;
+    size_t skippedStatements = 0;
+    long long elapsed = 0;
+
+    const CellDefinition* resolveCell(const TextSpan& type) {
+        auto cached = cellCache.find(type);
+        if (cached != cellCache.end()) {
+            return cached->second;
+        }
+        string name = type.str();
+        const CellDefinition* cell = library.find(name);
+        if (!cell) {
+            auto module = moduleCells.find(name);
+            cell = (module == moduleCells.end()) ? nullptr : &module->second;
+        }
+        cellCache[type] = cell;
+        return cell;
+    }
+
+    void placeNet(uint32_t index) {
+        const size_t mask = netSlots.size() - 1;
+        size_t slot = nets[index].hash & mask;
+        while (netSlots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        netSlots[slot] = (static_cast<uint64_t>(nets[index].hash) << 32) | (index + 1);
+    }
+
+    uint32_t internNet(const TextSpan& name, int line) {
+        if ((nets.size() + 1) * 2 > netSlots.size()) {
+            netSlots.assign(netSlots.size() * 2, 0);
+            for (uint32_t i = 0; i < nets.size(); ++i) {
+                placeNet(i);
+            }
+        }
+
+        const uint32_t hash = static_cast<uint32_t>(TextSpanHash()(name));
+        const size_t mask = netSlots.size() - 1;
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            uint64_t entry = netSlots[slot];
+            if (entry == 0) {
+                netSlots[slot] = (static_cast<uint64_t>(hash) << 32) | (nets.size() + 1);
+                nets.push_back({ name, hash, line, 0, 0, 0, 0, kNoBus, -1, -1 });
+                return static_cast<uint32_t>(nets.size()) - 1;
+            }
+            uint32_t index = static_cast<uint32_t>(entry) - 1;
+            if (static_cast<uint32_t>(entry >> 32) == hash && nets[index].name == name) {
+                return index;
+            }
+        }
+    }
+
+    void addConnection(const TextSpan& netName, PinDirection direction, uint32_t instance, int line) {
+        uint32_t id = internNet(netName, line);
+        Net& net = nets[id];
+        switch (direction) {
+        case PinDirection::Output:
+            ++net.drivers;
+            net.driverLine = line;
+            break;
+        case PinDirection::Input:
+            ++net.loads;
+            break;
+        case PinDirection::Inout:
+            net.flags |= NetPortInout;
+            break;
+        case PinDirection::Unknown:
+            net.flags |= NetOpaque;
+            break;
+        }
+        connections.push_back({ id, instance, direction });
+    }
+
+    // Reads one connection expression (a net, bit/part select, concatenation or constant) and connects every
+    // net in it. Stops before the ')' closing the port list, or before a ',' when stopAtComma is set.
+    void parseNetReferences(VerilogLexer& lexer, bool stopAtComma, PinDirection direction, uint32_t instance) {
+        int depth = 0;
+        while (true) {
+            const Token& token = lexer.peek();
+            if (token.kind == TokenKind::End || token.is(";") ||
+                (depth == 0 && (token.is(")") || (stopAtComma && token.is(","))))) {
+                return;
+            }
+            Token current = lexer.next();
+            if (current.is("(") || current.is("{")) {
+                ++depth;
+            }
+            else if (current.is(")") || current.is("}")) {
+                --depth;
+            }
+            else if (current.kind == TokenKind::Identifier) {
+                addConnection(readNetName(lexer, current), direction, instance, current.line);
+            }
+        }
+    }
+
+    // Extends an identifier with following bit or part selects, e.g. "data[3]". The name normally stays a
+    // span into the source; when whitespace or comments separate its tokens ("data [ 3 ]") it is rebuilt
+    // from the tokens alone, so every spelling of a select maps to the same net.
+    TextSpan readNetName(VerilogLexer& lexer, const Token& identifier) {
+        TextSpan name = identifier.text;
+        const char* selectEnd = name.data + name.size;
+        bool contiguous = true;
+        string rebuilt;
+        for (int brackets = 0; brackets > 0 || lexer.peek().is("[");) {
+            Token select = lexer.next();
+            if (select.kind == TokenKind::End) {
+                break;
+            }
+            if (contiguous && select.text.data != selectEnd) {
+                contiguous = false;
+                rebuilt.assign(name.data, selectEnd - name.data);
+            }
+            if (!contiguous) {
+                rebuilt.append(select.text.data, select.text.size);
+            }
+            brackets += select.is("[") ? 1 : select.is("]") ? -1 : 0;
+            selectEnd = select.text.data + select.text.size;
+        }
+        if (!contiguous) {
+            normalizedNames.push_back(move(rebuilt));
+            return TextSpan(normalizedNames.back().data(), normalizedNames.back().size());
+        }
+        name.size = selectEnd - name.data;
+        return name;
+    }
+
+    // Index of an already interned net, or UINT32_MAX
+    uint32_t findNet(const TextSpan& name) const {
+        const uint32_t hash = static_cast<uint32_t>(TextSpanHash()(name));
+        const size_t mask = netSlots.size() - 1;
+        for (size_t slot = hash & mask; netSlots[slot] != 0; slot = (slot + 1) & mask) {
+            uint32_t index = static_cast<uint32_t>(netSlots[slot]) - 1;
+            if (static_cast<uint32_t>(netSlots[slot] >> 32) == hash && nets[index].name == name) {
+                return index;
+            }
+        }
+        return UINT32_MAX;
+    }
+
+    // Parses "[hi]" or "[hi:lo]" with decimal bounds; anything else leaves the range unknown
+    static void parseSelectRange(const char* text, const char* end, int& low, int& high) {
+        low = high = -1;
+        int bounds[2] = { -1, -1 };
+        int count = 0;
+        for (++text; text < end && count < 2; ++text) {
+            if (!isdigit(static_cast<unsigned char>(*text))) {
+                return;
+            }
+            long long value = 0;
+            while (text < end && isdigit(static_cast<unsigned char>(*text)) && value < INT32_MAX / 10) {
+                value = value * 10 + (*text++ - '0');
+            }
+            bounds[count++] = static_cast<int>(value);
+            if (text >= end || (*text != ':' && *text != ']') || (*text == ']' && text + 1 != end)) {
+                return;
+            }
+            if (*text == ']') {
+                low = min(bounds[0], count == 2 ? bounds[1] : bounds[0]);
+                high = max(bounds[0], count == 2 ? bounds[1] : bounds[0]);
+                return;
+            }
+        }
+    }
+
+    uint32_t beginInstance(const TextSpan& type, const TextSpan& name, int line, const CellDefinition* cell) {
+        instances.push_back({ type, name, line, cell, static_cast<uint32_t>(connections.size()), 0 });
+        return static_cast<uint32_t>(instances.size() - 1);
+    }
+
+    void endInstance(uint32_t instance) {
+        instances[instance].connectionCount =
+            static_cast<uint32_t>(connections.size()) - instances[instance].firstConnection;
+    }
+
+    // TYPE [#(...)] name [range] ( connections ) {, name ( connections )} ;
+    void parseInstances(VerilogLexer& lexer, const Token& typeToken) {
+        const CellDefinition* cell = resolveCell(typeToken.text);
+        if (!cell) {
+            unknownCellTypes.insert(typeToken.text);
+        }
+        if (lexer.peek().is("#")) {
+            lexer.next();
+            if (lexer.next().is("(")) {
+                lexer.skipBalanced("(", ")");
+            }
+        }
+
+        while (true) {
+            Token nameToken = lexer.next();
+            if (nameToken.kind != TokenKind::Identifier) {
+                if (!nameToken.is(";")) {
+                    lexer.skipStatement();
+                }
+                return;
+            }
+            if (lexer.peek().is("[")) {
+                lexer.next();
+                lexer.skipBalanced("[", "]");
+            }
+            if (!lexer.next().is("(")) {
+                lexer.skipStatement();
+                return;
+            }
+
+            uint32_t instance = beginInstance(typeToken.text, nameToken.text, typeToken.line, cell);
+            if (!cell) {
+                ++unknownInstanceCount;
+            }
+            int position = 0;
+            while (true) {
+                int pin = position;
+                bool named = lexer.peek().is(".");
+                if (named) {
+                    lexer.next();
+                    Token pinName = lexer.next();
+                    pin = cell ? cell->findPin(pinName.text) : -1;
+                    lexer.next();  // '('
+                }
+                PinDirection direction = (cell && pin >= 0 && pin < static_cast<int>(cell->pins.size()))
+                    ? cell->pins[pin].direction : PinDirection::Unknown;
+                parseNetReferences(lexer, !named, direction, instance);
+                if (named) {
+                    lexer.next();  // ')' closing .PIN( ... )
+                }
+
+                Token separator = lexer.next();
+                if (separator.is(",")) {
+                    ++position;
+                    continue;
+                }
+                break;  // ')' closing the port list (or malformed input)
+            }
+            endInstance(instance);
+
+            Token after = lexer.next();
+            if (!after.is(",")) {
+                if (!after.is(";")) {
+                    lexer.skipStatement();
+                }
+                return;
+            }
+        }
+    }
+
+    // assign lhs = rhs {, lhs = rhs} ;  Each assignment becomes a buffer-like pseudo instance.
+    void parseAssign(VerilogLexer& lexer, int line) {
+        static const char assignName[] = "assign";
+        while (true) {
+            uint32_t instance = beginInstance(TextSpan(assignName, 6), TextSpan(assignName, 6), line, &assignCell);
+            PinDirection direction = PinDirection::Output;  // Left-hand side until '=', then right-hand side
+            int depth = 0;
+            while (true) {
+                const Token& token = lexer.peek();
+                if (token.kind == TokenKind::End || token.is(";") ||
+                    (depth == 0 && direction == PinDirection::Input && token.is(","))) {
+                    break;
+                }
+                Token current = lexer.next();
+                if (current.is("(") || current.is("{")) {
+                    ++depth;
+                }
+                else if (current.is(")") || current.is("}")) {
+                    --depth;
+                }
+                else if (depth == 0 && current.is("=")) {
+                    direction = PinDirection::Input;
+                }
+                else if (current.kind == TokenKind::Identifier) {
+                    addConnection(readNetName(lexer, current), direction, instance, current.line);
+                }
+            }
+            endInstance(instance);
+            if (!lexer.next().is(",")) {
+                return;
+            }
+        }
+    }
+
+    // input|output|inout [wire|reg] [signed] [range] name {, name} ;
+    void parsePortDeclaration(VerilogLexer& lexer, PinDirection direction) {
+        for (Token token = lexer.next(); token.kind != TokenKind::End && !token.is(";"); token = lexer.next()) {
+            if (token.is("[")) {
+                lexer.skipBalanced("[", "]");
+            }
+            else if (token.kind == TokenKind::Identifier && !isNetTypeKeyword(token.text)) {
+                portDirections[token.text] = direction;
+            }
+        }
+    }
+
+    static bool isNetTypeKeyword(const TextSpan& text) {
+        return text.equals("wire") || text.equals("reg") || text.equals("logic") || text.equals("signed") ||
+            text.equals("unsigned") || text.equals("tri") || text.equals("var");
+    }
+
+    static bool isDirectionKeyword(const TextSpan& text, PinDirection& direction) {
+        if (text.equals("input")) {
+            direction = PinDirection::Input;
+        }
+        else if (text.equals("output")) {
+            direction = PinDirection::Output;
+        }
+        else if (text.equals("inout")) {
+            direction = PinDirection::Inout;
+        }
+        else {
+            return false;
+        }
+        return true;
+    }
+
+    // Skips constructs the structural mode does not model (always/initial blocks, functions, generate, ...)
+    void skipBehavioral(VerilogLexer& lexer, const Token& keyword) {
+        ++skippedStatements;
+        static const pair<string, string> blockKeywords[] = {
+            { "function", "endfunction" }, { "task", "endtask" }, { "generate", "endgenerate" },
+            { "specify", "endspecify" }, { "primitive", "endprimitive" }
+        };
+        for (const auto& block : blockKeywords) {
+            if (keyword.text.equals(block.first)) {
+                for (Token token = lexer.next(); token.kind != TokenKind::End && !token.text.equals(block.second); token = lexer.next()) {
+                }
+                return;
+            }
+        }
+        if (keyword.is("always") || keyword.is("initial")) {
+            if (lexer.peek().is("@")) {
+                lexer.next();
+                if (lexer.next().is("(")) {
+                    lexer.skipBalanced("(", ")");
+                }
+            }
+            if (lexer.peek().is("begin")) {
+                lexer.next();
+                lexer.skipBalanced("begin", "end");
+                return;
+            }
+        }
+        lexer.skipStatement();
+    }
+
+    void parseModule(VerilogLexer& lexer) {
+        Token nameToken = lexer.next();
+        if (lexer.peek().is("#")) {
+            lexer.next();
+            if (lexer.next().is("(")) {
+                lexer.skipBalanced("(", ")");
+            }
+        }
+
+        // Port list, either plain names or ANSI declarations
+        if (lexer.peek().is("(")) {
+            lexer.next();
+            PinDirection direction = PinDirection::Unknown;
+            for (Token token = lexer.next(); token.kind != TokenKind::End && !token.is(")"); token = lexer.next()) {
+                if (token.is("[")) {
+                    lexer.skipBalanced("[", "]");
+                }
+                else if (token.kind == TokenKind::Identifier && !isDirectionKeyword(token.text, direction) &&
+                         !isNetTypeKeyword(token.text)) {
+                    portOrder.push_back(token.text);
+                    if (direction != PinDirection::Unknown) {
+                        portDirections[token.text] = direction;
+                    }
+                }
+            }
+        }
+        lexer.skipStatement();
+
+        while (true) {
+            Token token = lexer.next();
+            PinDirection direction;
+            if (token.kind == TokenKind::End || token.is("endmodule")) {
+                break;
+            }
+            if (token.kind != TokenKind::Identifier) {
+                continue;
+            }
+            if (isDirectionKeyword(token.text, direction)) {
+                parsePortDeclaration(lexer, direction);
+            }
+            else if (token.is("supply0") || token.is("supply1")) {
+                // Supply nets are driven by definition
+                parsePortDeclaration(lexer, PinDirection::Input);
+            }
+            else if (token.is("assign")) {
+                parseAssign(lexer, token.line);
+            }
+            else if (isNetTypeKeyword(token.text) || token.is("tri0") || token.is("tri1") || token.is("wand") ||
+                     token.is("wor") || token.is("parameter") || token.is("localparam") || token.is("defparam") ||
+                     token.is("genvar") || token.is("integer")) {
+                lexer.skipStatement();
+            }
+            else if (token.is("always") || token.is("initial") || token.is("function") || token.is("task") ||
+                     token.is("generate") || token.is("specify") || token.is("if") || token.is("else") ||
+                     token.is("for") || token.is("case") || token.is("begin")) {
+                skipBehavioral(lexer, token);
+            }
+            else {
+                parseInstances(lexer, token);
+            }
+        }
+
+        finishModule(nameToken.text);
+    }
+
+    // A select is also driven by drivers of its whole bus, and a whole bus is driven as soon as one of its
+    // selects is (widths are not tracked, so a partly driven bus counts as driven). Selects only conflict
+    // with the whole bus and with identical spellings, not with other overlapping selects.
+    void checkDrivers() {
+        for (const auto& net : nets) {
+            const Bus* bus = net.bus == kNoBus ? nullptr : &buses[net.bus];
+            const Net* whole = (bus && (net.flags & NetSelect) && bus->whole != UINT32_MAX) ? &nets[bus->whole] : nullptr;
+            uint32_t drivers = net.drivers + (whole ? whole->drivers : 0) + ((net.flags & NetPortInput) ? 1 : 0);
+            bool coveredByBus = false;
+            if (bus && !(net.flags & NetSelect)) {
+                coveredByBus = bus->selectDriven || bus->selectOpaque;
+            }
+            else if (bus) {
+                coveredByBus = (whole && (whole->flags & (NetPortInout | NetOpaque))) || bus->drives(net.low, net.high);
+            }
+            if (drivers > 1) {
+                violations.push_back({ "Multiple drivers on net " + net.name.str() + ": " + to_string(drivers) +
+                    " drivers" + ((net.flags & NetPortInput) ? " (including its input port)" : ""), net.driverLine ? net.driverLine : net.line });
+            }
+            else if (drivers == 0 && net.loads > 0 && !coveredByBus && !(net.flags & (NetPortInout | NetOpaque))) {
+                violations.push_back({ "Floating input: net " + net.name.str() + " has no driver but feeds " +
+                    to_string(net.loads) + " input pin(s)", net.line });
+            }
+        }
+    }
+
+    // Kahn's algorithm over combinational instances; whatever cannot be ordered lies on or behind a loop.
+    // Walking predecessors from each leftover instance then finds every loop once, in linear time overall.
+    void checkCombinationalLoops() {
+        const uint32_t netTotal = static_cast<uint32_t>(nets.size());
+        const uint32_t instanceTotal = static_cast<uint32_t>(instances.size());
+
+        // Net -> connections, as a compressed sparse row
+        vector<uint32_t> netStart(netTotal + 1, 0);
+        for (const auto& connection : connections) {
+            ++netStart[connection.net + 1];
+        }
+        for (uint32_t i = 0; i < netTotal; ++i) {
+            netStart[i + 1] += netStart[i];
+        }
+        vector<uint32_t> netConnections(connections.size());
+        {
+            vector<uint32_t> fill(netStart.begin(), netStart.end() - 1);
+            for (uint32_t i = 0; i < connections.size(); ++i) {
+                netConnections[fill[connections[i].net]++] = i;
+            }
+        }
+
+        auto isCombinational = [&](uint32_t instance) {
+            return instances[instance].cell && !instances[instance].cell->sequential;
+        };
+
+        vector<uint32_t> combinationalDrivers(netTotal, 0);
+        for (const auto& connection : connections) {
+            if (connection.direction == PinDirection::Output && isCombinational(connection.instance)) {
+                ++combinationalDrivers[connection.net];
+            }
+        }
+
+        vector<uint32_t> inDegree(instanceTotal, 0);
+        for (const auto& connection : connections) {
+            if (connection.direction == PinDirection::Input && isCombinational(connection.instance)) {
+                inDegree[connection.instance] += combinationalDrivers[connection.net];
+            }
+        }
+
+        vector<uint32_t> ready;
+        for (uint32_t i = 0; i < instanceTotal; ++i) {
+            if (isCombinational(i) && inDegree[i] == 0) {
+                ready.push_back(i);
+            }
+        }
+        while (!ready.empty()) {
+            uint32_t instance = ready.back();
+            ready.pop_back();
+            const Instance& current = instances[instance];
+            for (uint32_t c = current.firstConnection; c < current.firstConnection + current.connectionCount; ++c) {
+                if (connections[c].direction != PinDirection::Output) {
+                    continue;
+                }
+                uint32_t net = connections[c].net;
+                for (uint32_t k = netStart[net]; k < netStart[net + 1]; ++k) {
+                    const Connection& load = connections[netConnections[k]];
+                    if (load.direction == PinDirection::Input && isCombinational(load.instance) &&
+                        --inDegree[load.instance] == 0) {
+                        ready.push_back(load.instance);
+                    }
+                }
+            }
+        }
+
+        // Any leftover instance has a leftover combinational predecessor, so walking backwards must cycle
+        vector<uint32_t> walkId(instanceTotal, 0);
+        uint32_t currentWalk = 0;
+        for (uint32_t start = 0; start < instanceTotal; ++start) {
+            if (!isCombinational(start) || inDegree[start] == 0 || walkId[start] != 0) {
+                continue;
+            }
+            ++currentWalk;
+            vector<pair<uint32_t, uint32_t>> path;  // (instance, net it was reached through)
+            uint32_t instance = start;
+            uint32_t viaNet = UINT32_MAX;
+            while (walkId[instance] == 0) {
+                walkId[instance] = currentWalk;
+                path.emplace_back(instance, viaNet);
+                bool advanced = false;
+                const Instance& current = instances[instance];
+                for (uint32_t c = current.firstConnection; c < current.firstConnection + current.connectionCount && !advanced; ++c) {
+                    if (connections[c].direction != PinDirection::Input) {
+                        continue;
+                    }
+                    uint32_t net = connections[c].net;
+                    for (uint32_t k = netStart[net]; k < netStart[net + 1]; ++k) {
+                        const Connection& driver = connections[netConnections[k]];
+                        if (driver.direction == PinDirection::Output && isCombinational(driver.instance) &&
+                            inDegree[driver.instance] > 0) {
+                            instance = driver.instance;
+                            viaNet = net;
+                            advanced = true;
+                            break;
+                        }
+                    }
+                }
+                if (!advanced) {
+                    break;
+                }
+            }
+            if (walkId[instance] != currentWalk) {
+                continue;  // Reached a loop reported by an earlier walk
+            }
+
+            // The loop is the part of the path from the first visit of the repeated instance onwards
+            size_t loopStart = 0;
+            while (path[loopStart].first != instance) {
+                ++loopStart;
+            }
+            const Instance& anchor = instances[instance];
+            string message = "Combinational loop through " + to_string(path.size() - loopStart) + " cell(s): ";
+            for (size_t i = loopStart; i < path.size() && i < loopStart + 8; ++i) {
+                message += (i > loopStart ? " <- " : "") + instances[path[i].first].name.str();
+            }
+            if (path.size() - loopStart > 8) {
+                message += " <- ...";
+            }
+            message += " (net " + nets[viaNet].name.str() + ")";
+            violations.push_back({ message, anchor.line });
+        }
+    }
+
+    void finishModule(const TextSpan& moduleName) {
+        // Port flags and bus membership are applied once the whole module is read, so declaration order
+        // does not matter
+        for (uint32_t i = 0; i < nets.size(); ++i) {
+            Net& net = nets[i];
+            TextSpan base = net.name;
+            if (base.size > 0 && base.data[0] != '\\') {
+                const char* bracket = static_cast<const char*>(memchr(base.data, '[', base.size));
+                if (bracket) {
+                    base.size = bracket - base.data;
+                    net.flags |= NetSelect;
+                    parseSelectRange(bracket, net.name.data + net.name.size, net.low, net.high);
+                    auto inserted = busIndex.emplace(base, static_cast<uint32_t>(buses.size()));
+                    if (inserted.second) {
+                        buses.emplace_back();
+                        buses.back().whole = findNet(base);
+                    }
+                    net.bus = inserted.first->second;
+                }
+            }
+            auto port = portDirections.find(base);
+            if (port != portDirections.end()) {
+                net.flags |= (port->second == PinDirection::Input) ? NetPortInput
+                    : (port->second == PinDirection::Output) ? NetPortOutput : NetPortInout;
+            }
+        }
+        for (auto& net : nets) {
+            if (!(net.flags & NetSelect)) {
+                continue;
+            }
+            Bus& bus = buses[net.bus];
+            if (bus.whole != UINT32_MAX) {
+                nets[bus.whole].bus = net.bus;
+            }
+            bus.selectOpaque = bus.selectOpaque || (net.flags & (NetPortInout | NetOpaque)) != 0;
+            if (net.drivers > 0) {
+                bus.selectDriven = true;
+                if (net.low < 0) {
+                    bus.unknownRangeDriven = true;
+                }
+                else {
+                    bus.drivenRanges.emplace_back(net.low, net.high);
+                }
+            }
+        }
+        for (auto& bus : buses) {
+            sort(bus.drivenRanges.begin(), bus.drivenRanges.end());
+            int highest = -1;
+            for (const auto& range : bus.drivenRanges) {
+                highest = max(highest, range.second);
+                bus.highPrefixMax.push_back(highest);
+            }
+        }
+
+        checkDrivers();
+        checkCombinationalLoops();
+
+        // Make this module usable as a cell by later modules; it is opaque to the loop search
+        CellDefinition& definition = moduleCells[moduleName.str()];
+        definition.sequential = true;
+        for (const auto& port : portOrder) {
+            auto direction = portDirections.find(port);
+            definition.setPin(port.str(), direction == portDirections.end() ? PinDirection::Unknown : direction->second);
+        }
+
+        ++moduleCount;
+        instanceCount += instances.size();
+        netCount += nets.size();
+        size_t slotCount = 1024;
+        while (slotCount < nets.size() * 2) {
+            slotCount *= 2;
+        }
+        netSlots.assign(slotCount, 0);  // Sized for the last module, so many small modules stay cheap
+        portDirections.clear();
+        portOrder.clear();
+        nets.clear();
+        buses.clear();
+        busIndex.clear();
+        normalizedNames.clear();
+        instances.clear();
+        connections.clear();
+    }
+
+public:
+    explicit NetlistChecker(const CellLibrary& library) : library(library) {
+        assignCell.pins.push_back({ "lhs", PinDirection::Output });
+        assignCell.pins.push_back({ "rhs", PinDirection::Input });
+    }
+
+    void runChecks(const string& source) {
+        auto start = chrono::steady_clock::now();
+
+        // A gate-level instance line is roughly 50-80 bytes; reserving up front avoids repeated regrowth
+        const size_t estimatedInstances = min<size_t>(source.size() / 64, 1 << 22);
+        instances.reserve(estimatedInstances);
+        nets.reserve(estimatedInstances);
+        connections.reserve(estimatedInstances * 3);
+
+        VerilogLexer lexer(source.data(), source.data() + source.size());
+        for (Token token = lexer.next(); token.kind != TokenKind::End; token = lexer.next()) {
+            if (token.is("module") || token.is("macromodule")) {
+                parseModule(lexer);
+            }
+        }
+        elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+    }
+
+    void reportViolations() const {
+        cout << "Structural mode: " << moduleCount << " module(s), " << instanceCount << " instance(s), "
+            << netCount << " net(s) in " << elapsed << " ms" << endl;
+        if (unknownInstanceCount > 0) {
+            cout << "Note: " << unknownInstanceCount << " instance(s) of " << unknownCellTypes.size()
+                << " cell type(s) not in the cell library; their nets are not checked for floating inputs" << endl;
+        }
+        if (skippedStatements > 0) {
+            cout << "Note: " << skippedStatements << " behavioral construct(s) skipped in structural mode" << endl;
+        }
+        if (violations.empty()) {
+            cout << "No violations found!" << endl;
+        }
+        else {
+            cout << "Violations found:" << endl;
+            for (const auto& violation : violations) {
+                cout << "Line " << (violation.line ? to_string(violation.line) : "unknown") << ": " << violation.message << endl;
+            }
+        }
+    }
+};
+
+// Token range [begin, end) inside RtlModule::tokens
+struct RtlExpression {
+    uint32_t begin = 0;
+    uint32_t end = 0;
+
+    bool empty() const {
+        return begin >= end;
+    }
+};
+
+struct RtlPort {
+    string name;
+    PinDirection direction;
+    int width;  // 0 when the range is not a plain number, e.g. [WIDTH-1:0]
+    int line;
+};
+
+enum class ProcessKind { Combinational, Clocked, Initial };
+
+struct RtlProcess {
+    ProcessKind kind;
+    int line;
+};
+
+// One continuous or procedural assignment, "target = value"
+struct RtlAssignment {
+    RtlExpression target;
+    RtlExpression value;
+    int process;  // Index into RtlModule::processes, -1 for continuous assigns
+    int branch;   // Innermost enclosing branch, -1 when unconditional within its process
+    int line;
+};
+
+struct RtlCaseItem {
+    vector<RtlExpression> labels;
+    bool isDefault;
+    int line;
+};
+
+// An if or case statement; its arms are the branches that refer back to it
+struct RtlConditional {
+    bool isCase;
+    RtlExpression condition;      // if condition or case selector
+    vector<RtlCaseItem> items;    // case only
+    int process;
+    int branch;                   // Enclosing branch, -1 when at the top of its process
+    int line;
+    int elseLine = 0;             // if only; 0 when there is no else
+};
+
+struct RtlBranch {
+    int conditional;
+    int arm;  // 0 = then / 1 = else for an if, item index for a case
+};
+
+struct RtlParameter {
+    string name;
+    RtlExpression value;
+    bool isLocal;
+    int line;
+    int width;      // Declared range width; 0 without a range or when it is not plain numbers
+    bool typed;     // Declared with a range, signed or integer, so the value is converted to that type
+    bool isSigned;
+};
+
+struct RtlConnection {
+    string port;  // Empty for positional connections
+    RtlExpression actual;
+};
+
+struct RtlInstance {
+    string moduleName;
+    string name;
+    vector<RtlConnection> connections;
+    int line;
+};
+
+// Behavioral/structural view of one module definition. Expressions are kept as token ranges so later passes
+// can evaluate them; the tokens point into the source buffer owned by RtlDesign.
+struct RtlModule {
+    string name;
+    string filename;
+    int line = 0;
+    vector<Token> tokens;
+    vector<RtlPort> ports;
+    unordered_map<string, int> widths;  // Declared ports, nets and variables with a plain numeric range
+    unordered_set<string> signedSignals;  // Declared signed or integer
+    vector<RtlParameter> parameters;
+    vector<RtlProcess> processes;
+    vector<RtlAssignment> assignments;
+    vector<RtlConditional> conditionals;
+    vector<RtlBranch> branches;
+    vector<RtlInstance> instances;
+    size_t skippedConstructs = 0;      // generate blocks, functions and tasks are not modelled
+    vector<RtlExpression> unmodelledTargets;  // Targets assigned inside skipped code (for headers, tasks,
+                                              // functions, generate blocks) or driven by gate primitives
+                                              // other than buf; their values are unknown
+
+    int findPort(const string& portName) const {
+        for (size_t i = 0; i < ports.size(); ++i) {
+            if (ports[i].name == portName) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    // Calls visit(name, token index) for every signal read in the expression. Function and system task names,
+    // as well as the identifiers of a target (when asTarget is set) outside of index selects, are skipped.
+    template <typename Visitor>
+    void forEachSignal(const RtlExpression& expression, Visitor visit, bool asTarget = false) const {
+        int brackets = 0;
+        for (uint32_t i = expression.begin; i < expression.end; ++i) {
+            const Token& token = tokens[i];
+            if (token.is("[")) {
+                ++brackets;
+            }
+            else if (token.is("]")) {
+                --brackets;
+            }
+            else if (token.kind == TokenKind::Identifier && token.text.data[0] != '$' &&
+                     !(i + 1 < expression.end && tokens[i + 1].is("(")) && (!asTarget || brackets == 0)) {
+                visit(token.text.str(), i);
+            }
+        }
+    }
+
+    // Signals assigned by a target expression such as "q", "mem[i]" or "{carry, sum}"
+    template <typename Visitor>
+    void forEachTarget(const RtlExpression& target, Visitor visit) const {
+        forEachSignal(target, visit, true);
+    }
+};
+
+// Counts the nesting of a recursive-descent parser while one call is active
+struct DepthGuard {
+    size_t& depth;
+    explicit DepthGuard(size_t& depth) : depth(depth) { ++depth; }
+    ~DepthGuard() { --depth; }
+};
+
+// Parses the modules of one source buffer into RtlModule models
+class RtlModuleParser {
+private:
+    VerilogLexer lexer;
+    RtlModule* module = nullptr;
+
+    // Budget hooks: step is called once per statement, and nesting deeper than maxDepth (0 = unlimited)
+    // throws RuleAborted, so callers can bound the time and stack the recursive statement parser uses
+    size_t maxDepth;
+    function<void(int)> step;
+    size_t depth = 0;
+
+    enum StopAt { StopParen = 1, StopSemicolon = 2, StopComma = 4, StopColon = 8, StopAssign = 16 };
+
+    Token next() {
+        Token token = lexer.next();
+        if (module && token.kind != TokenKind::End) {
+            module->tokens.push_back(token);
+        }
+        return token;
+    }
+
+    const Token& peek() {
+        return lexer.peek();
+    }
+
+    bool accept(const Token& token, int stops, int depth) const {
+        if (token.kind == TokenKind::End) {
+            return true;
+        }
+        if (token.is(";")) {
+            return true;  // A statement never continues past ';'
+        }
+        if (depth > 0) {
+            return false;
+        }
+        return ((stops & StopParen) && token.is(")")) || ((stops & StopComma) && token.is(",")) ||
+            ((stops & StopColon) && token.is(":")) || ((stops & StopAssign) && (token.is("=") || token.is("<=")));
+    }
+
+    // Reads tokens up to (not including) the first stop token at nesting depth 0
+    RtlExpression readExpression(int stops) {
+        RtlExpression expression;
+        expression.begin = static_cast<uint32_t>(module->tokens.size());
+        int depth = 0;
+        while (!accept(peek(), stops, depth)) {
+            Token token = next();
+            if (token.is("(") || token.is("[") || token.is("{")) {
+                ++depth;
+            }
+            else if (token.is(")") || token.is("]") || token.is("}")) {
+                --depth;
+            }
+        }
+        expression.end = static_cast<uint32_t>(module->tokens.size());
+        return expression;
+    }
+
+    // Consumes a bracketed group whose opening token has already been read
+    template <size_t N, size_t M>
+    void skipBalanced(const char (&open)[N], const char (&close)[M]) {
+        for (int depth = 1; depth > 0;) {
+            Token token = next();
+            if (token.kind == TokenKind::End) {
+                return;
+            }
+            depth += token.is(open) ? 1 : token.is(close) ? -1 : 0;
+        }
+    }
+
+    void skipStatement() {
+        for (Token token = next(); token.kind != TokenKind::End && !token.is(";"); token = next()) {
+        }
+    }
+
+    // Records the target of every "target = ..." / "target <= ..." and of every named port connection in
+    // tokens [begin, end) that were skipped rather than parsed, so later passes know those signals are
+    // assigned somewhere they cannot see
+    void recordUnmodelledTargets(uint32_t begin, uint32_t end) {
+        uint32_t targetStart = begin;
+        bool inValue = false;  // Between '=' and the end of the statement
+        int brackets = 0;
+        int parens = 0;
+        for (uint32_t i = begin; i < end; ++i) {
+            const Token& token = module->tokens[i];
+            if (token.is("[") || token.is("{")) {
+                ++brackets;
+            }
+            else if (token.is("]") || token.is("}")) {
+                --brackets;
+            }
+            else if (token.is("(") || token.is(")")) {
+                parens += token.is("(") ? 1 : -1;
+                targetStart = i + 1;
+                if (token.is("(") && i >= begin + 2 && module->tokens[i - 2].is(".") &&
+                    module->tokens[i - 1].kind == TokenKind::Identifier) {
+                    // ".port(actual)": the instance may drive the actual
+                    uint32_t close = i + 1;
+                    for (int depth = 1; close < end; ++close) {
+                        depth += module->tokens[close].is("(") ? 1 : module->tokens[close].is(")") ? -1 : 0;
+                        if (depth == 0) {
+                            break;
+                        }
+                    }
+                    module->unmodelledTargets.push_back({ i + 1, close });
+                }
+            }
+            else if (token.is(";") || token.is("begin") || token.is("end") || token.is("else") ||
+                     (token.is(":") && brackets == 0)) {
+                targetStart = i + 1;
+                inValue = false;
+            }
+            else if ((token.is("=") || (token.is("<=") && parens == 0)) && !inValue) {
+                if (i > targetStart) {
+                    module->unmodelledTargets.push_back({ targetStart, i });
+                }
+                inValue = true;
+            }
+        }
+    }
+
+    // "[msb:lsb]" with plain numbers gives its width; anything else gives 0. The '[' is already consumed.
+    int readRange() {
+        RtlExpression range;
+        range.begin = static_cast<uint32_t>(module->tokens.size());
+        skipBalanced("[", "]");
+        range.end = static_cast<uint32_t>(module->tokens.size()) - 1;  // Without the closing ']'
+        int width = 0;
+        if (range.end - range.begin == 3 && module->tokens[range.begin].kind == TokenKind::Number &&
+            module->tokens[range.begin + 1].is(":") && module->tokens[range.begin + 2].kind == TokenKind::Number) {
+            const string msb = module->tokens[range.begin].text.str();
+            const string lsb = module->tokens[range.begin + 2].text.str();
+            if (msb.find('\'') == string::npos && lsb.find('\'') == string::npos) {
+                width = abs(atoi(msb.c_str()) - atoi(lsb.c_str())) + 1;
+            }
+        }
+        return width;
+    }
+
+    static bool isDataTypeKeyword(const Token& token) {
+        return token.is("wire") || token.is("reg") || token.is("logic") || token.is("signed") ||
+            token.is("unsigned") || token.is("tri") || token.is("var") || token.is("integer") ||
+            token.is("supply0") || token.is("supply1") || token.is("tri0") || token.is("tri1") ||
+            token.is("wand") || token.is("wor") || token.is("bit");
+    }
+
+    static bool isDirection(const Token& token, PinDirection& direction) {
+        if (token.is("input")) {
+            direction = PinDirection::Input;
+        }
+        else if (token.is("output")) {
+            direction = PinDirection::Output;
+        }
+        else if (token.is("inout")) {
+            direction = PinDirection::Inout;
+        }
+        else {
+            return false;
+        }
+        return true;
+    }
+
+    void declarePort(const string& name, PinDirection direction, int width, int line) {
+        int index = module->findPort(name);
+        if (index < 0) {
+            module->ports.push_back({ name, direction, width, line });
+        }
+        else if (direction != PinDirection::Unknown) {
+            module->ports[index].direction = direction;
+            module->ports[index].width = width;
+            module->ports[index].line = line;
+        }
+        module->widths[name] = width;
+    }
+
+    // input/output/wire/reg declarations: [direction] [types] [range] name [= value] {, name [= value]} ;
+    // Also used for ANSI port lists, where it stops at the ')' closing the header. keyword is a data type
+    // the caller has already read.
+    void parseDeclaration(PinDirection direction, bool isPort, bool inHeader, const Token* keyword = nullptr) {
+        int width = 1;
+        bool isSigned = false;
+        bool isVariable = false;
+        auto applyType = [&](const Token& token) {
+            if (token.is("reg") || token.is("logic") || token.is("integer")) {
+                isVariable = true;
+                if (token.is("integer")) {
+                    width = 32;
+                    isSigned = true;
+                }
+            }
+            else if (token.is("signed")) {
+                isSigned = true;
+            }
+        };
+        if (keyword) {
+            applyType(*keyword);
+        }
+        while (true) {
+            const Token& lookahead = peek();
+            if (lookahead.kind == TokenKind::End || lookahead.is(";") || (inHeader && lookahead.is(")"))) {
+                return;
+            }
+            Token token = next();
+            PinDirection newDirection;
+            if (inHeader && isDirection(token, newDirection)) {
+                direction = newDirection;
+                isPort = true;
+                width = 1;
+                isSigned = false;
+            }
+            else if (isDataTypeKeyword(token)) {
+                applyType(token);
+            }
+            else if (token.is("[")) {
+                width = readRange();
+            }
+            else if (token.kind == TokenKind::Identifier) {
+                string name = token.text.str();
+                RtlExpression target{ static_cast<uint32_t>(module->tokens.size() - 1),
+                    static_cast<uint32_t>(module->tokens.size()) };
+                if (isPort || inHeader) {
+                    declarePort(name, direction, width, token.line);
+                }
+                else {
+                    module->widths[name] = width;
+                }
+                if (isSigned) {
+                    module->signedSignals.insert(name);
+                }
+                // Unpacked dimensions belong to the name, not to the element width
+                while (peek().is("[")) {
+                    next();
+                    readRange();
+                }
+                if (peek().is("=")) {
+                    // Net declaration assignment, or a variable initializer (modelled as an initial assignment)
+                    next();
+                    RtlExpression value = readExpression(StopComma | (inHeader ? StopParen : 0));
+                    int process = -1;
+                    if (isVariable) {
+                        module->processes.push_back({ ProcessKind::Initial, token.line });
+                        process = static_cast<int>(module->processes.size()) - 1;
+                    }
+                    module->assignments.push_back({ target, value, process, -1, token.line });
+                }
+            }
+        }
+    }
+
+    // parameter/localparam [type] [range] NAME = value {, NAME = value}
+    void parseParameters(bool isLocal, bool inHeader) {
+        int width = 0;
+        bool typed = false;
+        bool isSigned = false;
+        while (true) {
+            const Token& lookahead = peek();
+            if (lookahead.kind == TokenKind::End || lookahead.is(";") || (inHeader && lookahead.is(")"))) {
+                return;
+            }
+            Token token = next();
+            if (token.is("[")) {
+                width = readRange();
+                typed = true;
+            }
+            else if (token.is("parameter") || token.is("localparam")) {
+                isLocal = token.is("localparam");
+                width = 0;
+                typed = isSigned = false;
+            }
+            else if (token.is("signed") || token.is("integer")) {
+                width = token.is("integer") ? 32 : width;
+                typed = isSigned = true;
+            }
+            else if (token.kind == TokenKind::Identifier && peek().is("=")) {
+                next();
+                RtlExpression value = readExpression(StopComma | (inHeader ? StopParen : 0));
+                module->parameters.push_back({ token.text.str(), value, isLocal, token.line, width, typed, isSigned });
+            }
+        }
+    }
+
+    void parseAssign() {
+        while (true) {
+            int line = peek().line;
+            RtlExpression target = readExpression(StopAssign | StopComma);
+            if (!peek().is("=")) {
+                skipStatement();
+                return;
+            }
+            next();
+            RtlExpression value = readExpression(StopComma);
+            module->assignments.push_back({ target, value, -1, -1, line });
+            if (!next().is(",")) {
+                return;
+            }
+        }
+    }
+
+    int addBranch(int conditional, int arm) {
+        module->branches.push_back({ conditional, arm });
+        return static_cast<int>(module->branches.size()) - 1;
+    }
+
+    // Procedural statement parser; tracks the if/case structure around every assignment
+    void parseStatement(int process, int branch) {
+        const Token& lookahead = peek();
+        if (lookahead.kind == TokenKind::End || lookahead.is("end") || lookahead.is("endcase") ||
+            lookahead.is("endmodule") || lookahead.is("join")) {
+            return;
+        }
+        DepthGuard guard(depth);
+        if (maxDepth > 0 && depth > maxDepth) {
+            throw RuleAborted{ "recursion depth budget of " + to_string(maxDepth) + " exhausted", lookahead.line };
+        }
+        if (step) {
+            step(lookahead.line);
+        }
+
+        Token token = next();
+        if (token.is(";")) {
+            return;
+        }
+        if (token.is("begin") || token.is("fork")) {
+            if (peek().is(":")) {
+                next();
+                next();
+            }
+            while (peek().kind != TokenKind::End && !peek().is("end") && !peek().is("join") &&
+                   !peek().is("endmodule")) {
+                size_t before = module->tokens.size();
+                parseStatement(process, branch);
+                if (module->tokens.size() == before) {
+                    next();  // Stray keyword such as "endcase" that no statement starts with
+                }
+            }
+            if (peek().is("end") || peek().is("join")) {
+                next();
+            }
+            return;
+        }
+        if (token.is("if")) {
+            // "else if" chains are followed in a loop, so long priority chains do not nest the recursion
+            int line = token.line;
+            while (true) {
+                next();  // '('
+                RtlConditional conditional{ false, readExpression(StopParen), {}, process, branch, line };
+                next();  // ')'
+                module->conditionals.push_back(conditional);
+                int index = static_cast<int>(module->conditionals.size()) - 1;
+                parseStatement(process, addBranch(index, 0));
+                if (!peek().is("else")) {
+                    return;
+                }
+                module->conditionals[index].elseLine = next().line;
+                branch = addBranch(index, 1);
+                if (!peek().is("if")) {
+                    parseStatement(process, branch);
+                    return;
+                }
+                line = next().line;
+                if (step) {
+                    step(line);
+                }
+            }
+        }
+        if (token.is("case") || token.is("casez") || token.is("casex")) {
+            next();  // '('
+            RtlConditional conditional{ true, readExpression(StopParen), {}, process, branch, token.line };
+            next();  // ')'
+            module->conditionals.push_back(conditional);
+            int index = static_cast<int>(module->conditionals.size()) - 1;
+            while (peek().kind != TokenKind::End && !peek().is("endcase") && !peek().is("endmodule")) {
+                RtlCaseItem item{ {}, false, peek().line };
+                if (peek().is("default")) {
+                    next();
+                    item.isDefault = true;
+                }
+                else {
+                    while (true) {
+                        item.labels.push_back(readExpression(StopComma | StopColon));
+                        if (!peek().is(",")) {
+                            break;
+                        }
+                        next();
+                    }
+                }
+                if (peek().is(":")) {
+                    next();
+                }
+                else if (!item.isDefault) {
+                    skipStatement();  // Malformed item; resynchronise at the next ';'
+                    continue;
+                }
+                module->conditionals[index].items.push_back(item);
+                parseStatement(process, addBranch(index, static_cast<int>(module->conditionals[index].items.size()) - 1));
+            }
+            if (peek().is("endcase")) {
+                next();
+            }
+            return;
+        }
+        if (token.is("for") || token.is("while") || token.is("repeat") || token.is("wait")) {
+            if (next().is("(")) {
+                uint32_t header = static_cast<uint32_t>(module->tokens.size());
+                skipBalanced("(", ")");
+                recordUnmodelledTargets(header, static_cast<uint32_t>(module->tokens.size()));
+            }
+            parseStatement(process, branch);
+            return;
+        }
+        if (token.is("forever")) {
+            parseStatement(process, branch);
+            return;
+        }
+        if (token.is("#") || token.is("@")) {
+            // Delay or event control in front of a statement
+            if (peek().is("(")) {
+                next();
+                skipBalanced("(", ")");
+            }
+            else {
+                next();
+            }
+            parseStatement(process, branch);
+            return;
+        }
+        if (token.kind != TokenKind::Identifier && !token.is("{")) {
+            skipStatement();
+            return;
+        }
+
+        // Assignment "target = value;" / "target <= value;", anything else (task calls, disable, ...) is skipped
+        uint32_t targetBegin = static_cast<uint32_t>(module->tokens.size() - 1);
+        RtlExpression rest = readExpression(StopAssign);
+        if (!peek().is("=") && !peek().is("<=")) {
+            skipStatement();
+            return;
+        }
+        RtlExpression target{ targetBegin, rest.end };
+        next();
+        if (peek().is("#") || peek().is("@")) {
+            // Intra-assignment timing control
+            next();
+            if (peek().is("(")) {
+                next();
+                skipBalanced("(", ")");
+            }
+            else {
+                next();
+            }
+        }
+        RtlExpression value = readExpression(0);
+        if (peek().is(";")) {
+            next();
+        }
+        module->assignments.push_back({ target, value, process, branch, token.line });
+    }
+
+    void parseProcess(const Token& keyword) {
+        ProcessKind kind = keyword.is("initial") ? ProcessKind::Initial
+            : keyword.is("always_ff") ? ProcessKind::Clocked : ProcessKind::Combinational;
+        if (peek().is("@")) {
+            next();
+            if (peek().is("(")) {
+                next();
+                RtlExpression sensitivity = readExpression(StopParen);
+                next();
+                for (uint32_t i = sensitivity.begin; i < sensitivity.end; ++i) {
+                    if (module->tokens[i].is("posedge") || module->tokens[i].is("negedge")) {
+                        kind = ProcessKind::Clocked;
+                    }
+                }
+            }
+            else {
+                next();  // "@*"
+            }
+        }
+        module->processes.push_back({ kind, keyword.line });
+        parseStatement(static_cast<int>(module->processes.size()) - 1, -1);
+    }
+
+    // TYPE [#(...)] name [range] ( connections ) {, name ( connections )} ;
+    void parseInstances(const Token& typeToken) {
+        static const char* const gatePrimitives[] = { "and", "nand", "or", "nor", "xor", "xnor", "buf", "not" };
+        bool isPrimitive = false;
+        for (const char* gate : gatePrimitives) {
+            isPrimitive = isPrimitive || typeToken.text.equals(string(gate));
+        }
+
+        if (peek().is("#")) {
+            next();
+            if (next().is("(")) {
+                skipBalanced("(", ")");
+            }
+        }
+        while (true) {
+            // Gate primitives may omit the instance name
+            Token nameToken = (isPrimitive && peek().is("(")) ? typeToken : next();
+            if (nameToken.kind != TokenKind::Identifier) {
+                if (!nameToken.is(";")) {
+                    skipStatement();
+                }
+                return;
+            }
+            if (peek().is("[")) {
+                next();
+                readRange();
+            }
+            if (!next().is("(")) {
+                skipStatement();
+                return;
+            }
+
+            RtlInstance instance{ typeToken.text.str(), nameToken.text.str(), {}, typeToken.line };
+            while (peek().kind != TokenKind::End && !peek().is(")") && !peek().is(";")) {
+                RtlConnection connection;
+                if (peek().is(".")) {
+                    next();
+                    connection.port = next().text.str();
+                    next();  // '('
+                    connection.actual = readExpression(StopParen);
+                    next();  // ')'
+                }
+                else {
+                    connection.actual = readExpression(StopComma | StopParen);
+                }
+                instance.connections.push_back(connection);
+                if (peek().is(",")) {
+                    next();
+                }
+            }
+            next();  // ')'
+
+            if (isPrimitive && !instance.connections.empty()) {
+                // "and g (y, a, b);" is a continuous assignment of y from the remaining terminals. Only buf
+                // passes its input through unchanged; the value of any other gate's output is not modelled.
+                RtlExpression inputs = instance.connections.size() > 1 ? RtlExpression{
+                    instance.connections[1].actual.begin, instance.connections.back().actual.end } : RtlExpression{};
+                module->assignments.push_back({ instance.connections[0].actual, inputs, -1, -1, typeToken.line });
+                if (!typeToken.is("buf")) {
+                    module->unmodelledTargets.push_back(instance.connections[0].actual);
+                }
+            }
+            else {
+                module->instances.push_back(instance);
+            }
+
+            Token after = next();
+            if (!after.is(",")) {
+                if (!after.is(";")) {
+                    skipStatement();
+                }
+                return;
+            }
+        }
+    }
+
+    void skipUntil(const Token& keyword) {
+        static const pair<string, string> blocks[] = {
+            { "function", "endfunction" }, { "task", "endtask" }, { "generate", "endgenerate" },
+            { "specify", "endspecify" }
+        };
+        ++module->skippedConstructs;
+        for (const auto& block : blocks) {
+            if (keyword.text.equals(block.first)) {
+                uint32_t body = static_cast<uint32_t>(module->tokens.size());
+                for (Token token = next(); token.kind != TokenKind::End && !token.text.equals(block.second); token = next()) {
+                }
+                recordUnmodelledTargets(body, static_cast<uint32_t>(module->tokens.size()));
+                return;
+            }
+        }
+    }
+
+    void parseModule(RtlModule& target) {
+        module = &target;
+        Token nameToken = next();
+        module->name = nameToken.text.str();
+        module->line = nameToken.line;
+
+        if (peek().is("#")) {
+            next();
+            next();  // '('
+            parseParameters(false, true);
+            next();  // ')'
+        }
+        if (peek().is("(")) {
+            next();
+            parseDeclaration(PinDirection::Unknown, true, true);
+            next();  // ')'
+        }
+        skipStatement();
+
+        while (true) {
+            Token token = next();
+            PinDirection direction;
+            if (token.kind == TokenKind::End || token.is("endmodule")) {
+                break;
+            }
+            if (token.kind != TokenKind::Identifier) {
+                continue;
+            }
+            if (isDirection(token, direction)) {
+                parseDeclaration(direction, true, false);
+            }
+            else if (isDataTypeKeyword(token)) {
+                parseDeclaration(PinDirection::Unknown, false, false, &token);
+            }
+            else if (token.is("parameter") || token.is("localparam")) {
+                parseParameters(token.is("localparam"), false);
+            }
+            else if (token.is("assign")) {
+                parseAssign();
+            }
+            else if (token.is("always") || token.is("always_comb") || token.is("always_latch") ||
+                     token.is("always_ff") || token.is("initial")) {
+                parseProcess(token);
+            }
+            else if (token.is("function") || token.is("task") || token.is("generate") || token.is("specify")) {
+                skipUntil(token);
+            }
+            else if (token.is("defparam") || token.is("genvar") || token.is("real") || token.is("time") ||
+                     token.is("event")) {
+                skipStatement();
+            }
+            else {
+                parseInstances(token);
+            }
+        }
+        module = nullptr;
+    }
+
+public:
+    RtlModuleParser(const char* begin, const char* end, size_t maxDepth = 0, function<void(int)> step = nullptr)
+        : lexer(begin, end), maxDepth(maxDepth), step(step) {}
+
+    // Parses every module in the buffer, appending them to modules
+    void parse(const string& filename, vector<RtlModule>& modules) {
+        for (Token token = lexer.next(); token.kind != TokenKind::End; token = lexer.next()) {
+            if (token.is("module") || token.is("macromodule")) {
+                modules.emplace_back();
+                modules.back().filename = filename;
+                parseModule(modules.back());
+            }
+        }
+    }
+};
+
+// All module definitions of the files given on the command line; owns the sources their tokens point into
+class RtlDesign {
+private:
+    vector<unique_ptr<string>> sources;
+    vector<RtlModule> modules;
+    unordered_map<string, size_t> moduleIndex;
+
+public:
+    // Parses every module of a file; when statements nest deeper than maxDepth the rest of the file is
+    // dropped with a warning and the modules read so far are kept
+    void addSource(const string& filename, string source, size_t maxDepth = 0) {
+        sources.push_back(unique_ptr<string>(new string(move(source))));
+        const string& text = *sources.back();
+        size_t first = modules.size();
+        try {
+            RtlModuleParser(text.data(), text.data() + text.size(), maxDepth).parse(filename, modules);
+        }
+        catch (const RuleAborted& abort) {
+            cerr << "Warning: " << filename << ":" << abort.line << ": stopped reading the hierarchy: "
+                << abort.reason << endl;
+        }
+        for (size_t i = first; i < modules.size(); ++i) {
+            if (!moduleIndex.emplace(modules[i].name, i).second) {
+                cerr << "Warning: module " << modules[i].name << " in " << filename
+                    << " is already defined; keeping the first definition" << endl;
+            }
+        }
+    }
+
+    const RtlModule* find(const string& name) const {
+        auto it = moduleIndex.find(name);
+        return it == moduleIndex.end() ? nullptr : &modules[it->second];
+    }
+
+    const vector<RtlModule>& getModules() const {
+        return modules;
+    }
+};
+
+// One constant value; width 0 marks an unsized literal, which Verilog treats as 32 bits
+struct ConstantValue {
+    uint64_t bits;
+    int width;
+    bool isSigned = false;  // Unsized decimals, 's literals, signed/integer declarations
+
+    bool operator==(const ConstantValue& other) const {
+        return bits == other.bits && width == other.width && isSigned == other.isSigned;
+    }
+};
+
+// Lattice element of the constant propagation: bottom (no value reaches it yet), a small set of possible
+// constants, or overdefined (anything). Each element can only move up, and a set that would grow past
+// kMaxValues becomes overdefined, so every signal changes a bounded number of times.
+struct ConstantSet {
+    static const size_t kMaxValues = 16;
+
+    bool overdefined = false;
+    bool fromParameter = false;  // Depends on a parameter that an instantiation may override
+    vector<ConstantValue> values;
+
+    static ConstantSet top(bool fromParameter = false) {
+        ConstantSet set;
+        set.overdefined = true;
+        set.fromParameter = fromParameter;
+        return set;
+    }
+
+    static ConstantSet single(ConstantValue value, bool fromParameter = false) {
+        ConstantSet set;
+        set.values.push_back(value);
+        set.fromParameter = fromParameter;
+        return set;
+    }
+
+    bool isBottom() const {
+        return !overdefined && values.empty();
+    }
+
+    bool isKnown() const {
+        return !overdefined && !values.empty();
+    }
+
+    void add(const ConstantValue& value) {
+        if (overdefined || find(values.begin(), values.end(), value) != values.end()) {
+            return;
+        }
+        if (values.size() >= kMaxValues) {
+            overdefined = true;
+            values.clear();
+            return;
+        }
+        values.push_back(value);
+    }
+
+    // Least upper bound; returns true when this set changed
+    bool join(const ConstantSet& other) {
+        bool changed = false;
+        if (other.fromParameter && !fromParameter) {
+            fromParameter = changed = true;
+        }
+        if (overdefined) {
+            return changed;
+        }
+        if (other.overdefined) {
+            overdefined = true;
+            values.clear();
+            return true;
+        }
+        for (const auto& value : other.values) {
+            size_t before = values.size();
+            add(value);
+            changed = changed || overdefined || values.size() != before;
+            if (overdefined) {
+                break;
+            }
+        }
+        return changed;
+    }
+};
+
+// Sparse conditional constant propagation over one RtlModule. Parameters, localparams, continuous assigns
+// and procedural assignments are definitions of their target signal; a definition only counts once the
+// branch around it is known to be executable, and a branch only becomes executable once its if condition
+// or case selector can take a matching value. Worklists of changed signals, definitions and conditionals
+// drive everything to a fixpoint in time roughly linear in the size of the module.
+class ConstantPropagator {
+private:
+    struct Definition {
+        int target;
+        RtlExpression value;
+        int branch;
+        int line;
+        bool overridable;  // Non-local parameter
+    };
+
+    const RtlModule& module;
+    function<void(int)> step;  // Called once per worklist item, so the caller can enforce its budget
+    size_t maxDepth;           // Expression nesting limit, 0 for none
+    size_t depth = 0;
+
+    unordered_map<string, int> signalIds;
+    vector<ConstantSet> signalValues;
+    vector<int> signalWidths;
+    vector<int> signalSigned;                // 1 signed, 0 unsigned, -1 takes the signedness of its value
+    vector<vector<int>> definitionReaders;   // Per signal: definitions whose value reads it
+    vector<vector<int>> conditionalReaders;  // Per signal: conditionals whose condition or labels read it
+    vector<bool> signalDefined;
+
+    vector<Definition> definitions;
+    vector<vector<int>> branchDefinitions;   // Definitions directly inside each branch
+    vector<vector<int>> branchConditionals;  // Conditionals directly inside each branch
+    vector<vector<int>> armBranches;         // Per conditional: branch index of each arm
+    vector<bool> branchExecutable;
+    vector<bool> decidedByParameter;         // Per conditional: its outcome depends on an overridable parameter
+
+    vector<int> signalWork, definitionWork, conditionalWork;
+    vector<bool> signalQueued, definitionQueued, conditionalQueued;
+
+    // Expression evaluation state
+    uint32_t position = 0;
+    uint32_t limit = 0;
+
+    int signalId(const string& name) {
+        auto inserted = signalIds.emplace(name, static_cast<int>(signalValues.size()));
+        if (inserted.second) {
+            signalValues.emplace_back();
+            auto width = module.widths.find(name);
+            signalWidths.push_back(width == module.widths.end() ? 0 : width->second);
+            signalSigned.push_back(module.signedSignals.count(name) ? 1 : width == module.widths.end() ? -1 : 0);
+            definitionReaders.emplace_back();
+            conditionalReaders.emplace_back();
+            signalDefined.push_back(false);
+            signalQueued.push_back(false);
+        }
+        return inserted.first->second;
+    }
+
+    static uint64_t maskFor(int width) {
+        int bits = width == 0 ? 32 : width;
+        return bits >= 64 ? ~0ULL : ((1ULL << bits) - 1);
+    }
+
+    static int effectiveWidth(const ConstantValue& value) {
+        return value.width == 0 ? 32 : value.width;
+    }
+
+    // The value widened to 64 bits: sign-extended when signed, zero-extended otherwise
+    static uint64_t extend(const ConstantValue& value) {
+        const int width = effectiveWidth(value);
+        const uint64_t bits = value.bits & maskFor(width);
+        return value.isSigned && width < 64 && (bits >> (width - 1)) & 1 ? bits | ~maskFor(width) : bits;
+    }
+
+    static int64_t asSigned(uint64_t bits, int width) {
+        return static_cast<int64_t>(extend({ bits, width, true }));
+    }
+
+    // Parses a Verilog number; returns false for values with x, z or ? digits and for widths over 64 bits
+    static bool parseNumber(const TextSpan& text, ConstantValue& value) {
+        int width = 0;
+        int base = 10;
+        bool isSigned = true;  // Plain decimals are signed; based literals only with 's
+        const char* quote = static_cast<const char*>(memchr(text.data, '\'', text.size));
+        const char* cursor = text.data;
+        const char* end = text.data + text.size;
+        if (quote) {
+            for (; cursor < quote; ++cursor) {
+                if (isdigit(static_cast<unsigned char>(*cursor))) {
+                    width = width * 10 + (*cursor - '0');
+                }
+            }
+            cursor = quote + 1;
+            isSigned = cursor < end && (*cursor == 's' || *cursor == 'S');
+            if (isSigned) {
+                ++cursor;
+            }
+            char baseChar = cursor < end ? static_cast<char>(tolower(*cursor++)) : 'd';
+            base = baseChar == 'b' ? 2 : baseChar == 'o' ? 8 : baseChar == 'h' ? 16 : 10;
+        }
+        if (width > 64) {
+            return false;
+        }
+        uint64_t bits = 0;
+        for (; cursor < end; ++cursor) {
+            char c = static_cast<char>(tolower(*cursor));
+            if (c == '_' || c == ' ' || c == '\t') {
+                continue;
+            }
+            if (c == 'x' || c == 'z' || c == '?') {
+                return false;
+            }
+            int digit = isdigit(static_cast<unsigned char>(c)) ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : -1;
+            if (digit < 0 || digit >= base) {
+                return false;
+            }
+            bits = bits * base + digit;
+        }
+        value = { bits & maskFor(width), width, isSigned };
+        return true;
+    }
+
+    const Token& peekToken() const {
+        return module.tokens[position];
+    }
+
+    bool atEnd() const {
+        return position >= limit;
+    }
+
+    template <size_t N>
+    bool acceptToken(const char (&text)[N]) {
+        if (!atEnd() && peekToken().is(text)) {
+            ++position;
+            return true;
+        }
+        return false;
+    }
+
+    // Applies op to every combination of values; bottom stays bottom, overdefined or too many combinations
+    // give overdefined
+    template <typename Operation>
+    static ConstantSet combine(const ConstantSet& left, const ConstantSet& right, Operation operation) {
+        bool fromParameter = left.fromParameter || right.fromParameter;
+        if (left.isBottom() || right.isBottom()) {
+            ConstantSet bottom;
+            bottom.fromParameter = fromParameter;
+            return bottom;
+        }
+        if (left.overdefined || right.overdefined ||
+            left.values.size() * right.values.size() > ConstantSet::kMaxValues * ConstantSet::kMaxValues) {
+            return ConstantSet::top(fromParameter);
+        }
+        ConstantSet result;
+        result.fromParameter = fromParameter;
+        for (const auto& a : left.values) {
+            for (const auto& b : right.values) {
+                ConstantValue value;
+                if (!operation(a, b, value)) {
+                    return ConstantSet::top(fromParameter);
+                }
+                result.add(value);
+            }
+        }
+        return result;
+    }
+
+    template <typename Operation>
+    static ConstantSet transform(const ConstantSet& operand, Operation operation) {
+        return combine(operand, ConstantSet::single({ 0, 1 }, false), [&](const ConstantValue& a, const ConstantValue&, ConstantValue& result) {
+            return operation(a, result);
+        });
+    }
+
+    static bool allZero(const ConstantSet& set) {
+        if (!set.isKnown()) {
+            return false;
+        }
+        for (const auto& value : set.values) {
+            if ((value.bits & maskFor(value.width)) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool noneZero(const ConstantSet& set) {
+        if (!set.isKnown()) {
+            return false;
+        }
+        for (const auto& value : set.values) {
+            if ((value.bits & maskFor(value.width)) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The operands are signed only when both are, as in Verilog; a signed operand is sign-extended to the
+    // width of the operation
+    static bool applyBinary(const TextSpan& op, const ConstantValue& a, const ConstantValue& b, ConstantValue& result) {
+        const int width = max(effectiveWidth(a), effectiveWidth(b));
+        const uint64_t mask = maskFor(width);
+        const bool isSigned = a.isSigned && b.isSigned;
+        const uint64_t x = (isSigned ? extend(a) : a.bits) & mask;
+        const uint64_t y = (isSigned ? extend(b) : b.bits) & mask;
+        const int64_t sx = asSigned(x, width);
+        const int64_t sy = asSigned(y, width);
+        auto logical = [&](bool condition) {
+            result = { condition ? 1ULL : 0ULL, 1 };
+            return true;
+        };
+        auto arithmetic = [&](uint64_t value) {
+            result = { value & mask, width, isSigned };
+            return true;
+        };
+        auto divide = [&](bool remainder) {
+            if (y == 0 || (isSigned && sx == INT64_MIN && sy == -1)) {
+                return false;
+            }
+            return isSigned ? arithmetic(static_cast<uint64_t>(remainder ? sx % sy : sx / sy))
+                : arithmetic(remainder ? x % y : x / y);
+        };
+
+        if (op.equals("+")) return arithmetic(x + y);
+        if (op.equals("-")) return arithmetic(x - y);
+        if (op.equals("*")) return arithmetic(x * y);
+        if (op.equals("/")) return divide(false);
+        if (op.equals("%")) return divide(true);
+        if (op.equals("&")) return arithmetic(x & y);
+        if (op.equals("|")) return arithmetic(x | y);
+        if (op.equals("^")) return arithmetic(x ^ y);
+        if (op.equals("~^") || op.equals("^~")) return arithmetic(~(x ^ y));
+        if (op.equals("~&")) return arithmetic(~(x & y));
+        if (op.equals("~|")) return arithmetic(~(x | y));
+        if (op.equals("==") || op.equals("===")) return logical(x == y);
+        if (op.equals("!=") || op.equals("!==")) return logical(x != y);
+        if (op.equals("<")) return logical(isSigned ? sx < sy : x < y);
+        if (op.equals("<=")) return logical(isSigned ? sx <= sy : x <= y);
+        if (op.equals(">")) return logical(isSigned ? sx > sy : x > y);
+        if (op.equals(">=")) return logical(isSigned ? sx >= sy : x >= y);
+        if (op.equals("&&")) return logical(x != 0 && y != 0);
+        if (op.equals("||")) return logical(x != 0 || y != 0);
+        // Shifts keep the width and signedness of the left operand; the amount is always unsigned
+        const uint64_t amount = b.bits & maskFor(b.width);
+        if (op.equals("<<") || op.equals("<<<")) {
+            result = { amount >= 64 ? 0 : (a.bits << amount) & maskFor(a.width), a.width, a.isSigned };
+            return true;
+        }
+        if (op.equals(">>>") && a.isSigned) {
+            result = { static_cast<uint64_t>(asSigned(a.bits, effectiveWidth(a)) >> min<uint64_t>(amount, 63)) &
+                maskFor(a.width), a.width, true };
+            return true;
+        }
+        if (op.equals(">>") || op.equals(">>>")) {
+            result = { amount >= 64 ? 0 : (a.bits & maskFor(a.width)) >> amount, a.width, a.isSigned };
+            return true;
+        }
+        if (op.equals("**")) {
+            uint64_t power = 1;
+            for (uint64_t i = 0; i < y && i < 64; ++i) {
+                power *= x;
+            }
+            return arithmetic(power);
+        }
+        return false;
+    }
+
+    static int precedence(const Token& token) {
+        if (token.kind != TokenKind::Symbol) return 0;
+        const TextSpan& op = token.text;
+        if (op.equals("**")) return 11;
+        if (op.equals("*") || op.equals("/") || op.equals("%")) return 10;
+        if (op.equals("+") || op.equals("-")) return 9;
+        if (op.equals("<<") || op.equals(">>") || op.equals("<<<") || op.equals(">>>")) return 8;
+        if (op.equals("<") || op.equals("<=") || op.equals(">") || op.equals(">=")) return 7;
+        if (op.equals("==") || op.equals("!=") || op.equals("===") || op.equals("!==")) return 6;
+        if (op.equals("&") || op.equals("~&")) return 5;
+        if (op.equals("^") || op.equals("~^") || op.equals("^~")) return 4;
+        if (op.equals("|") || op.equals("~|")) return 3;
+        if (op.equals("&&")) return 2;
+        if (op.equals("||")) return 1;
+        return 0;
+    }
+
+    // Skips the rest of a bracketed group after a construct the evaluator does not model
+    ConstantSet giveUp(int depth) {
+        while (!atEnd() && depth > 0) {
+            const Token& token = module.tokens[position++];
+            if (token.is("(") || token.is("[") || token.is("{")) {
+                ++depth;
+            }
+            else if (token.is(")") || token.is("]") || token.is("}")) {
+                --depth;
+            }
+        }
+        return ConstantSet::top();
+    }
+
+    // The evaluator's recursive calls each count one level, so maxDepth bounds its stack like the parser's
+    void checkDepth() const {
+        if (maxDepth && depth > maxDepth) {
+            throw RuleAborted{ "recursion depth budget of " + to_string(maxDepth) + " exhausted",
+                module.tokens[position < limit ? position : limit - 1].line };
+        }
+    }
+
+    ConstantSet parseSelect(ConstantSet base) {
+        while (acceptToken("[")) {
+            ConstantSet first = parseConditional();
+            if (acceptToken(":")) {
+                ConstantSet low = parseConditional();
+                acceptToken("]");
+                base = combine(combine(base, first, [](const ConstantValue& v, const ConstantValue& m, ConstantValue& r) {
+                    r = v;
+                    r.width = static_cast<int>(m.bits) + 1;  // Keep msb for the second step
+                    return m.bits < 64;
+                }), low, [](const ConstantValue& v, const ConstantValue& l, ConstantValue& r) {
+                    if (l.bits >= 64 || static_cast<int>(l.bits) >= v.width) {
+                        return false;
+                    }
+                    int width = v.width - static_cast<int>(l.bits);
+                    r = { (v.bits >> l.bits) & maskFor(width), width };
+                    return true;
+                });
+            }
+            else if (acceptToken("+:") || acceptToken("-:")) {
+                parseConditional();
+                acceptToken("]");
+                base = ConstantSet::top(base.fromParameter);
+            }
+            else {
+                acceptToken("]");
+                base = combine(base, first, [](const ConstantValue& v, const ConstantValue& i, ConstantValue& r) {
+                    r = { i.bits < 64 ? (v.bits >> i.bits) & 1 : 0, 1 };
+                    return true;
+                });
+            }
+        }
+        return base;
+    }
+
+    ConstantSet parsePrimary() {
+        DepthGuard guard(depth);
+        checkDepth();
+        if (atEnd()) {
+            return ConstantSet::top();
+        }
+        Token token = module.tokens[position++];
+        if (token.is("(")) {
+            ConstantSet inner = parseConditional();
+            acceptToken(")");
+            return inner;
+        }
+        if (token.kind == TokenKind::Number) {
+            ConstantValue value;
+            return parseNumber(token.text, value) ? ConstantSet::single(value) : ConstantSet::top();
+        }
+        if (token.kind == TokenKind::Identifier) {
+            if (!atEnd() && peekToken().is("(")) {
+                ++position;
+                return giveUp(1);  // Function call
+            }
+            auto id = signalIds.find(token.text.str());
+            return parseSelect(id == signalIds.end() ? ConstantSet::top() : signalValues[id->second]);
+        }
+        if (token.is("{")) {
+            ConstantSet first = parseConditional();
+            if (!atEnd() && peekToken().is("{")) {
+                // Replication {n{value}}
+                ++position;
+                ConstantSet inner = parseConcatenation();
+                acceptToken("}");
+                return combine(first, inner, [](const ConstantValue& count, const ConstantValue& v, ConstantValue& r) {
+                    if (v.width == 0 || count.bits == 0 || count.bits * v.width > 64) {
+                        return false;
+                    }
+                    r = { 0, static_cast<int>(count.bits) * v.width };
+                    for (uint64_t i = 0; i < count.bits; ++i) {
+                        r.bits = (r.bits << v.width) | v.bits;
+                    }
+                    return true;
+                });
+            }
+            ConstantSet result = first;
+            while (acceptToken(",")) {
+                result = appendConcatenation(result, parseConditional());
+            }
+            acceptToken("}");
+            return result;
+        }
+        return ConstantSet::top();
+    }
+
+    // The items of "{a, b, c}" after the opening brace, up to and including the closing one
+    ConstantSet parseConcatenation() {
+        ConstantSet result = parseConditional();
+        while (acceptToken(",")) {
+            result = appendConcatenation(result, parseConditional());
+        }
+        acceptToken("}");
+        return result;
+    }
+
+    static ConstantSet appendConcatenation(const ConstantSet& high, const ConstantSet& low) {
+        return combine(high, low, [](const ConstantValue& h, const ConstantValue& l, ConstantValue& r) {
+            if (h.width == 0 || l.width == 0 || h.width + l.width > 64) {
+                return false;
+            }
+            r = { (h.bits << l.width) | l.bits, h.width + l.width };
+            return true;
+        });
+    }
+
+    ConstantSet parseUnary() {
+        DepthGuard guard(depth);
+        checkDepth();
+        if (atEnd()) {
+            return ConstantSet::top();
+        }
+        const Token& token = peekToken();
+        if (token.kind == TokenKind::Symbol && (token.is("!") || token.is("~") || token.is("-") || token.is("+") ||
+            token.is("&") || token.is("|") || token.is("^") || token.is("~&") || token.is("~|") ||
+            token.is("~^") || token.is("^~"))) {
+            TextSpan op = token.text;
+            ++position;
+            ConstantSet operand = parseUnary();
+            return transform(operand, [op](const ConstantValue& v, ConstantValue& r) {
+                const uint64_t mask = maskFor(v.width);
+                const uint64_t bits = v.bits & mask;
+                uint64_t parity = 0;
+                for (uint64_t rest = bits; rest; rest &= rest - 1) {
+                    parity ^= 1;
+                }
+                if (op.equals("!")) r = { bits == 0 ? 1ULL : 0ULL, 1 };
+                else if (op.equals("~")) r = { ~bits & mask, v.width, v.isSigned };
+                else if (op.equals("-")) r = { (~bits + 1) & mask, v.width, v.isSigned };
+                else if (op.equals("+")) r = v;
+                else if (op.equals("&")) r = { bits == mask ? 1ULL : 0ULL, 1 };
+                else if (op.equals("~&")) r = { bits == mask ? 0ULL : 1ULL, 1 };
+                else if (op.equals("|")) r = { bits != 0 ? 1ULL : 0ULL, 1 };
+                else if (op.equals("~|")) r = { bits != 0 ? 0ULL : 1ULL, 1 };
+                else if (op.equals("^")) r = { parity, 1 };
+                else r = { parity ^ 1, 1 };
+                return true;
+            });
+        }
+        return parsePrimary();
+    }
+
+    ConstantSet parseBinary(int minimumPrecedence) {
+        DepthGuard guard(depth);
+        checkDepth();
+        ConstantSet left = parseUnary();
+        while (!atEnd()) {
+            int current = precedence(peekToken());
+            if (current == 0 || current < minimumPrecedence) {
+                break;
+            }
+            TextSpan op = peekToken().text;
+            ++position;
+            ConstantSet right = parseBinary(current + 1);
+
+            // A known-false operand decides &&, a known-true one decides ||, whatever the other side is
+            if (op.equals("&&") && (allZero(left) || allZero(right))) {
+                left = ConstantSet::single({ 0, 1 }, allZero(left) ? left.fromParameter : right.fromParameter);
+            }
+            else if (op.equals("||") && (noneZero(left) || noneZero(right))) {
+                left = ConstantSet::single({ 1, 1 }, noneZero(left) ? left.fromParameter : right.fromParameter);
+            }
+            else {
+                left = combine(left, right, [op](const ConstantValue& a, const ConstantValue& b, ConstantValue& r) {
+                    return applyBinary(op, a, b, r);
+                });
+            }
+        }
+        return left;
+    }
+
+    ConstantSet parseConditional() {
+        DepthGuard guard(depth);
+        checkDepth();
+        ConstantSet condition = parseBinary(1);
+        if (!acceptToken("?")) {
+            return condition;
+        }
+        ConstantSet whenTrue = parseConditional();
+        acceptToken(":");
+        ConstantSet whenFalse = parseConditional();
+        if (condition.isBottom()) {
+            return condition;
+        }
+        ConstantSet result;
+        if (noneZero(condition)) {
+            result = whenTrue;
+        }
+        else if (allZero(condition)) {
+            result = whenFalse;
+        }
+        else {
+            result = whenTrue;
+            result.join(whenFalse);
+        }
+        result.fromParameter = result.fromParameter || condition.fromParameter;
+        return result;
+    }
+
+    ConstantSet evaluate(const RtlExpression& expression) {
+        if (expression.empty()) {
+            return ConstantSet::top();
+        }
+        position = expression.begin;
+        limit = expression.end;
+        ConstantSet result = parseConditional();
+        return atEnd() ? result : ConstantSet::top(result.fromParameter);  // Trailing tokens: not understood
+    }
+
+    void queueSignal(int signal) {
+        if (!signalQueued[signal]) {
+            signalQueued[signal] = true;
+            signalWork.push_back(signal);
+        }
+    }
+
+    void queueDefinition(int definition) {
+        if (!definitionQueued[definition]) {
+            definitionQueued[definition] = true;
+            definitionWork.push_back(definition);
+        }
+    }
+
+    void queueConditional(int conditional) {
+        if (!conditionalQueued[conditional]) {
+            conditionalQueued[conditional] = true;
+            conditionalWork.push_back(conditional);
+        }
+    }
+
+    bool isExecutable(int branch) const {
+        return branch < 0 || branchExecutable[branch];
+    }
+
+    void markExecutable(int branch) {
+        if (branchExecutable[branch]) {
+            return;
+        }
+        branchExecutable[branch] = true;
+        for (int definition : branchDefinitions[branch]) {
+            queueDefinition(definition);
+        }
+        for (int conditional : branchConditionals[branch]) {
+            queueConditional(conditional);
+        }
+    }
+
+    void setOverdefined(int signal) {
+        if (signalValues[signal].join(ConstantSet::top())) {
+            queueSignal(signal);
+        }
+    }
+
+    static bool matches(const ConstantValue& selector, const ConstantValue& label) {
+        const uint64_t mask = maskFor(max(effectiveWidth(selector), effectiveWidth(label)));
+        const bool isSigned = selector.isSigned && label.isSigned;
+        return ((isSigned ? extend(selector) : selector.bits) & mask) == ((isSigned ? extend(label) : label.bits) & mask);
+    }
+
+    // Re-evaluates which arms of an if or case can be taken and marks them executable
+    void visitConditional(int index) {
+        const RtlConditional& conditional = module.conditionals[index];
+        if (!isExecutable(conditional.branch)) {
+            return;
+        }
+        step(conditional.line);
+        ConstantSet selector = evaluate(conditional.condition);
+        if (selector.isBottom()) {
+            return;
+        }
+        decidedByParameter[index] = decidedByParameter[index] || selector.fromParameter;
+        const vector<int>& arms = armBranches[index];
+
+        if (!conditional.isCase) {
+            if (!arms.empty() && (selector.overdefined || !allZero(selector))) {
+                markExecutable(arms[0]);
+            }
+            if (arms.size() > 1 && (selector.overdefined || !noneZero(selector))) {
+                markExecutable(arms[1]);
+            }
+            return;
+        }
+
+        // Case items in priority order. A label that is a single constant definitely takes that value, so no
+        // later item can match it, whether or not the selector is known. Values are kept masked to their
+        // width, so equal bits mean a match.
+        unordered_set<uint64_t> taken;
+        auto selectorCanBe = [&](const ConstantValue& value) {
+            if (taken.count(value.bits)) {
+                return false;
+            }
+            if (selector.overdefined) {
+                return true;
+            }
+            for (const auto& candidate : selector.values) {
+                if (matches(candidate, value)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        auto selectorHasUntaken = [&]() {
+            if (selector.overdefined) {
+                return true;
+            }
+            for (const auto& candidate : selector.values) {
+                if (!taken.count(candidate.bits)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (size_t item = 0; item < conditional.items.size() && item < arms.size(); ++item) {
+            const RtlCaseItem& caseItem = conditional.items[item];
+            if (caseItem.isDefault) {
+                if (selectorHasUntaken()) {
+                    markExecutable(arms[item]);
+                }
+                continue;
+            }
+            bool reachable = false;
+            vector<uint64_t> claimed;
+            for (const auto& labelExpression : caseItem.labels) {
+                ConstantSet label = evaluate(labelExpression);
+                decidedByParameter[index] = decidedByParameter[index] || label.fromParameter;
+                if (label.overdefined) {
+                    // Wildcard or unknown label may match any value no earlier item has taken
+                    reachable = reachable || selectorHasUntaken();
+                    continue;
+                }
+                for (const auto& value : label.values) {
+                    reachable = reachable || selectorCanBe(value);
+                }
+                if (label.values.size() == 1) {
+                    claimed.push_back(label.values[0].bits);
+                }
+            }
+            taken.insert(claimed.begin(), claimed.end());
+            if (reachable) {
+                markExecutable(arms[item]);
+            }
+        }
+    }
+
+    void visitDefinition(int index) {
+        const Definition& definition = definitions[index];
+        if (!isExecutable(definition.branch)) {
+            return;
+        }
+        step(definition.line);
+        ConstantSet value = evaluate(definition.value);
+        value.fromParameter = value.fromParameter || definition.overridable;
+        // Convert to the declared type: sign- or zero-extend, truncate, then take the declared signedness
+        const int width = signalWidths[definition.target];
+        const int isSigned = signalSigned[definition.target];
+        if (value.isKnown() && ((width > 0 && width <= 64) || isSigned >= 0)) {
+            ConstantSet sized;
+            sized.fromParameter = value.fromParameter;
+            for (const auto& v : value.values) {
+                ConstantValue converted = v;
+                if (width > 0 && width <= 64) {
+                    converted = { extend(v) & maskFor(width), width };
+                }
+                converted.isSigned = isSigned >= 0 ? isSigned == 1 : v.isSigned;
+                sized.add(converted);
+            }
+            value = sized;
+        }
+        if (signalValues[definition.target].join(value)) {
+            queueSignal(definition.target);
+        }
+    }
+
+    void build() {
+        // Parameters first, so their names resolve to parameter signals
+        for (const auto& parameter : module.parameters) {
+            int target = signalId(parameter.name);
+            signalDefined[target] = true;
+            signalWidths[target] = parameter.width;
+            signalSigned[target] = parameter.typed ? parameter.isSigned : -1;
+            definitions.push_back({ target, parameter.value, -1, parameter.line, !parameter.isLocal });
+        }
+
+        for (const auto& assignment : module.assignments) {
+            // Only whole-signal targets are modelled; partial or concatenated targets become overdefined
+            const RtlExpression& target = assignment.target;
+            bool simple = target.end - target.begin == 1 && module.tokens[target.begin].kind == TokenKind::Identifier;
+            int id = -1;
+            module.forEachTarget(target, [&](const string& name, uint32_t) {
+                id = signalId(name);
+                signalDefined[id] = true;
+                if (!simple) {
+                    signalValues[id] = ConstantSet::top();
+                }
+            });
+            if (simple && id >= 0) {
+                definitions.push_back({ id, assignment.value, assignment.branch, assignment.line, false });
+            }
+        }
+
+        // Signals assigned where the model cannot see (for headers, tasks, functions, generate blocks, gate
+        // outputs) can hold anything, even when they also have definitions the model does see
+        for (const auto& target : module.unmodelledTargets) {
+            module.forEachTarget(target, [&](const string& name, uint32_t) {
+                int id = signalId(name);
+                signalDefined[id] = true;
+                signalValues[id] = ConstantSet::top();
+            });
+        }
+
+        // Ports driven from outside and nets connected to instances can hold anything
+        for (const auto& port : module.ports) {
+            if (port.direction != PinDirection::Output) {
+                signalValues[signalId(port.name)] = ConstantSet::top();
+            }
+        }
+        for (const auto& instance : module.instances) {
+            for (const auto& connection : instance.connections) {
+                module.forEachSignal(connection.actual, [&](const string& name, uint32_t) {
+                    signalValues[signalId(name)] = ConstantSet::top();
+                });
+            }
+        }
+
+        // Readers of every signal
+        for (size_t d = 0; d < definitions.size(); ++d) {
+            module.forEachSignal(definitions[d].value, [&](const string& name, uint32_t) {
+                definitionReaders[signalId(name)].push_back(static_cast<int>(d));
+            });
+        }
+        for (size_t c = 0; c < module.conditionals.size(); ++c) {
+            const RtlConditional& conditional = module.conditionals[c];
+            auto addReader = [&](const string& name, uint32_t) {
+                conditionalReaders[signalId(name)].push_back(static_cast<int>(c));
+            };
+            module.forEachSignal(conditional.condition, addReader);
+            for (const auto& item : conditional.items) {
+                for (const auto& label : item.labels) {
+                    module.forEachSignal(label, addReader);
+                }
+            }
+        }
+
+        // Signals nothing defines (undeclared, or assigned only by tasks and generate blocks) can hold anything
+        for (size_t s = 0; s < signalValues.size(); ++s) {
+            if (!signalDefined[s]) {
+                signalValues[s] = ConstantSet::top();
+            }
+        }
+
+        branchExecutable.assign(module.branches.size(), false);
+        branchDefinitions.resize(module.branches.size());
+        branchConditionals.resize(module.branches.size());
+        armBranches.resize(module.conditionals.size());
+        decidedByParameter.assign(module.conditionals.size(), false);
+        for (size_t b = 0; b < module.branches.size(); ++b) {
+            armBranches[module.branches[b].conditional].push_back(static_cast<int>(b));
+        }
+        definitionQueued.assign(definitions.size(), false);
+        conditionalQueued.assign(module.conditionals.size(), false);
+        signalQueued.assign(signalValues.size(), false);
+        for (size_t d = 0; d < definitions.size(); ++d) {
+            if (definitions[d].branch >= 0) {
+                branchDefinitions[definitions[d].branch].push_back(static_cast<int>(d));
+            }
+            else {
+                queueDefinition(static_cast<int>(d));
+            }
+        }
+        for (size_t c = 0; c < module.conditionals.size(); ++c) {
+            if (module.conditionals[c].branch >= 0) {
+                branchConditionals[module.conditionals[c].branch].push_back(static_cast<int>(c));
+            }
+            else {
+                queueConditional(static_cast<int>(c));
+            }
+        }
+    }
+
+    void drain() {
+        while (!signalWork.empty() || !definitionWork.empty() || !conditionalWork.empty()) {
+            if (!definitionWork.empty()) {
+                int definition = definitionWork.back();
+                definitionWork.pop_back();
+                definitionQueued[definition] = false;
+                visitDefinition(definition);
+            }
+            else if (!conditionalWork.empty()) {
+                int conditional = conditionalWork.back();
+                conditionalWork.pop_back();
+                conditionalQueued[conditional] = false;
+                visitConditional(conditional);
+            }
+            else {
+                int signal = signalWork.back();
+                signalWork.pop_back();
+                signalQueued[signal] = false;
+                for (int definition : definitionReaders[signal]) {
+                    queueDefinition(definition);
+                }
+                for (int conditional : conditionalReaders[signal]) {
+                    queueConditional(conditional);
+                }
+            }
+        }
+    }
+
+public:
+    ConstantPropagator(const RtlModule& module, function<void(int)> step, size_t maxDepth = 0)
+        : module(module), step(step), maxDepth(maxDepth) {}
+
+    void run() {
+        build();
+        drain();
+
+        // Signals whose every definition sits in unreachable code never get a value; rather than letting that
+        // make their readers look dead, treat them as unknown and settle again
+        bool settled = false;
+        while (!settled) {
+            settled = true;
+            for (size_t s = 0; s < signalValues.size(); ++s) {
+                if (signalValues[s].isBottom() && (!definitionReaders[s].empty() || !conditionalReaders[s].empty())) {
+                    setOverdefined(static_cast<int>(s));
+                    settled = false;
+                }
+            }
+            drain();
+        }
+    }
+
+    // Reports branches that can never be taken, as (line, message) through report
+    template <typename Reporter>
+    void reportUnreachable(Reporter report) const {
+        for (size_t c = 0; c < module.conditionals.size(); ++c) {
+            const RtlConditional& conditional = module.conditionals[c];
+            if (!isExecutable(conditional.branch)) {
+                continue;  // Inside code that is already reported as unreachable
+            }
+            const string suffix = decidedByParameter[c] ? " (with default parameter values)" : "";
+            const vector<int>& arms = armBranches[c];
+            if (!conditional.isCase) {
+                if (!arms.empty() && !branchExecutable[arms[0]]) {
+                    report(conditional.line, "Unreachable if-else statement at line: " + to_string(conditional.line) + suffix);
+                }
+                if (arms.size() > 1 && !branchExecutable[arms[1]]) {
+                    report(conditional.elseLine, "Unreachable else branch at line: " + to_string(conditional.elseLine) + suffix);
+                }
+                continue;
+            }
+            for (size_t item = 0; item < conditional.items.size() && item < arms.size(); ++item) {
+                if (!conditional.items[item].isDefault && !branchExecutable[arms[item]]) {
+                    int line = conditional.items[item].line;
+                    report(line, "Unreachable 'case' branch at line: " + to_string(line) + suffix);
+                }
+            }
+        }
+    }
+};
+
+// Runs constant propagation on every module of the file and reports branches that can never be taken
+void StaticChecker::checkDeadCode() {
+    string source;
+    for (const auto& line : lines) {
+        source += line + "\n";
+    }
+
+    static const string noSubject;
+    auto step = [this](int line) { consume(noSubject, line); };
+    vector<RtlModule> modules;
+    RtlModuleParser(source.data(), source.data() + source.size(), budget.maxRecursionDepth, step).parse("", modules);
+    for (const auto& module : modules) {
+        ConstantPropagator propagator(module, step, budget.maxRecursionDepth);
+        propagator.run();
+        propagator.reportUnreachable([this](int line, const string& message) {
+            violations.push_back({ message, line });
+        });
+    }
+}
+
+// What a parent needs to know about a module definition, computed once per definition and reused at every
+// instance of it
+struct ModuleSummary {
+    vector<RtlPort> ports;
+    vector<vector<int>> combinationalInputs;  // Per output port: input ports it depends on combinationally
+    vector<bool> producesX;                   // Per output port: may carry an X produced inside the module
+    vector<bool> driven;                      // Per output port: has a driver inside the module
+    bool blackBox = false;                    // Neither defined in the design nor in the cell library
+    uint64_t instanceCount = 0;               // Instances in the subtree below one instance of this module
+};
+
+// Elaborates the hierarchy below a top module. Every module definition is analyzed once into a
+// ModuleSummary; parents compose the summaries of their children at each instance instead of re-analyzing
+// them, so the loop, X propagation and driver checks see through module ports at the cost of one analysis
+// per definition.
+class HierarchyElaborator {
+private:
+    // Signal graph of the module being analyzed
+    struct Edge {
+        int to;
+        int instance;      // Instance whose port-to-port path creates the edge, -1 for local logic
+        bool combinational;
+    };
+
+    struct Driver {
+        string description;
+        bool fromInstance;
+        int line;
+    };
+
+    const RtlDesign& design;
+    const CellLibrary& library;
+    unordered_map<string, ModuleSummary> summaries;
+    unordered_set<string> inProgress;
+    unordered_set<string> blackBoxes;
+    vector<Violation> violations;
+    size_t analyzedModules = 0;
+    uint64_t elaboratedInstances = 0;
+
+    static bool containsXLiteral(const RtlModule& module, const RtlExpression& expression) {
+        for (uint32_t i = expression.begin; i < expression.end; ++i) {
+            const Token& token = module.tokens[i];
+            if (token.kind != TokenKind::Number) {
+                continue;
+            }
+            const char* quote = static_cast<const char*>(memchr(token.text.data, '\'', token.text.size));
+            if (quote && memchr(quote, 'x', token.text.data + token.text.size - quote) != nullptr) {
+                return true;
+            }
+            if (quote && memchr(quote, 'X', token.text.data + token.text.size - quote) != nullptr) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void report(const RtlModule& module, const string& message, int line) {
+        violations.push_back({ "[" + module.filename + ": " + module.name + "] " + message, line });
+    }
+
+    ModuleSummary summarizeCell(const CellDefinition& cell) {
+        ModuleSummary summary;
+        vector<int> inputs;
+        for (size_t i = 0; i < cell.pins.size(); ++i) {
+            summary.ports.push_back({ cell.pins[i].name, cell.pins[i].direction, 1, 0 });
+            if (cell.pins[i].direction == PinDirection::Input) {
+                inputs.push_back(static_cast<int>(i));
+            }
+        }
+        summary.combinationalInputs.resize(cell.pins.size());
+        summary.producesX.assign(cell.pins.size(), false);
+        summary.driven.assign(cell.pins.size(), true);
+        for (size_t i = 0; i < cell.pins.size(); ++i) {
+            if (cell.pins[i].direction == PinDirection::Output && !cell.sequential) {
+                summary.combinationalInputs[i] = inputs;
+            }
+        }
+        return summary;
+    }
+
+    const ModuleSummary& summarize(const string& name) {
+        auto cached = summaries.find(name);
+        if (cached != summaries.end()) {
+            return cached->second;
+        }
+
+        ModuleSummary summary;
+        const RtlModule* module = design.find(name);
+        const CellDefinition* cell = module ? nullptr : library.find(name);
+        if (module) {
+            inProgress.insert(name);
+            summary = analyze(*module);
+            inProgress.erase(name);
+        }
+        else if (cell) {
+            summary = summarizeCell(*cell);
+        }
+        else {
+            summary.blackBox = true;
+            blackBoxes.insert(name);
+        }
+        return summaries.emplace(name, move(summary)).first->second;
+    }
+
+    // Tarjan's strongly connected components over the combinational edges, iteratively so deep designs
+    // cannot overflow the stack. Reports each loop that passes through at least one instance; loops made of
+    // local assigns only are already reported by the flat CombinationalLoops rule.
+    void checkLoops(const RtlModule& module, const vector<string>& names, const vector<vector<Edge>>& graph) {
+        const int count = static_cast<int>(graph.size());
+        vector<int> index(count, -1), lowLink(count, 0), component(count, -1);
+        vector<bool> onStack(count, false);
+        vector<int> stack;
+        vector<pair<int, size_t>> callStack;
+        int nextIndex = 0;
+        int componentCount = 0;
+
+        for (int root = 0; root < count; ++root) {
+            if (index[root] != -1) {
+                continue;
+            }
+            callStack.emplace_back(root, 0);
+            index[root] = lowLink[root] = nextIndex++;
+            stack.push_back(root);
+            onStack[root] = true;
+
+            while (!callStack.empty()) {
+                int node = callStack.back().first;
+                size_t& edge = callStack.back().second;
+                if (edge < graph[node].size()) {
+                    const Edge& next = graph[node][edge++];
+                    if (!next.combinational) {
+                        continue;
+                    }
+                    if (index[next.to] == -1) {
+                        index[next.to] = lowLink[next.to] = nextIndex++;
+                        stack.push_back(next.to);
+                        onStack[next.to] = true;
+                        callStack.emplace_back(next.to, 0);
+                    }
+                    else if (onStack[next.to]) {
+                        lowLink[node] = min(lowLink[node], index[next.to]);
+                    }
+                    continue;
+                }
+
+                if (lowLink[node] == index[node]) {
+                    int member;
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = false;
+                        component[member] = componentCount;
+                    } while (member != node);
+                    ++componentCount;
+                }
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    int parent = callStack.back().first;
+                    lowLink[parent] = min(lowLink[parent], lowLink[node]);
+                }
+            }
+        }
+
+        // A component is a loop when one of its combinational edges stays inside it
+        vector<bool> reported(componentCount, false);
+        for (int node = 0; node < count; ++node) {
+            for (const Edge& edge : graph[node]) {
+                if (!edge.combinational || edge.instance < 0 || component[edge.to] != component[node] ||
+                    reported[component[node]]) {
+                    continue;
+                }
+                reported[component[node]] = true;
+                const RtlInstance& instance = module.instances[edge.instance];
+                report(module, "Combinational loop through instance " + instance.name + " (" + instance.moduleName +
+                    "): " + names[node] + " -> " + names[edge.to], instance.line);
+            }
+        }
+    }
+
+    // "name[7:4]" / "name[3]" with plain decimal bounds at tokens[index] gives its range; anything else (no
+    // select, a variable index, several dimensions) gives (-1, -1), meaning the whole signal
+    static void constantSelect(const RtlModule& module, uint32_t index, int& low, int& high) {
+        low = high = -1;
+        const vector<Token>& tokens = module.tokens;
+        auto plainNumber = [&](uint32_t i) {
+            return i < tokens.size() && tokens[i].kind == TokenKind::Number &&
+                !memchr(tokens[i].text.data, '\'', tokens[i].text.size);
+        };
+        if (index + 3 >= tokens.size() || !tokens[index + 1].is("[") || !plainNumber(index + 2)) {
+            return;
+        }
+        int first = atoi(tokens[index + 2].text.str().c_str());
+        int second = first;
+        uint32_t close = index + 3;
+        if (tokens[close].is(":") && plainNumber(close + 1)) {
+            second = atoi(tokens[close + 1].text.str().c_str());
+            close += 2;
+        }
+        if (close >= tokens.size() || !tokens[close].is("]") || (close + 1 < tokens.size() && tokens[close + 1].is("["))) {
+            return;
+        }
+        low = min(first, second);
+        high = max(first, second);
+    }
+
+    ModuleSummary analyze(const RtlModule& module) {
+        ++analyzedModules;
+        ModuleSummary summary;
+        summary.ports = module.ports;
+
+        // Graph nodes are whole signals and their constant selects ("c", "c[3]", "c[7:4]"), so the bits of a
+        // bus chained through instances (a ripple carry) are not one node
+        unordered_map<string, int> ids;
+        vector<string> names;
+        vector<int> nodeBase;
+        vector<pair<int, int>> nodeRange;    // (-1, -1) for the whole signal
+        unordered_map<string, int> baseIds;
+        vector<vector<int>> baseNodes;
+        auto node = [&](const string& name, int low, int high) {
+            string key = low < 0 ? name : name + "[" + (low == high ? to_string(low) : to_string(high) + ":" + to_string(low)) + "]";
+            auto inserted = ids.emplace(key, static_cast<int>(names.size()));
+            if (inserted.second) {
+                auto base = baseIds.emplace(name, static_cast<int>(baseNodes.size()));
+                if (base.second) {
+                    baseNodes.emplace_back();
+                }
+                names.push_back(key);
+                nodeBase.push_back(base.first->second);
+                nodeRange.emplace_back(low, high);
+                baseNodes[base.first->second].push_back(inserted.first->second);
+            }
+            return inserted.first->second;
+        };
+        auto signal = [&](const string& name) {
+            return node(name, -1, -1);
+        };
+        auto signalAt = [&](const string& name, uint32_t index) {
+            int low, high;
+            constantSelect(module, index, low, high);
+            return node(name, low, high);
+        };
+
+        // Reads are resolved into edges once every written node is known: a read depends on each written
+        // node it overlaps, which keeps disjoint selects of one bus apart
+        struct Dependency {
+            int from;
+            int to;
+            int instance;
+            bool combinational;
+        };
+        vector<Dependency> dependencies;
+        vector<int> writtenNodes;
+        for (const auto& port : module.ports) {
+            int id = signal(port.name);
+            if (port.direction == PinDirection::Input || port.direction == PinDirection::Inout) {
+                writtenNodes.push_back(id);
+            }
+        }
+        vector<int> xSources;
+        unordered_map<int, vector<Driver>> drivers;
+
+        // Each if/case gets an internal node fed by its condition and by the enclosing conditional, so a
+        // target depends on every enclosing condition without copying them per assignment (an else-if chain
+        // of n arms stays linear). Only instance edges name a loop, so these nodes never show up in messages.
+        vector<int> conditionNodes(module.conditionals.size());
+        for (size_t c = 0; c < module.conditionals.size(); ++c) {
+            conditionNodes[c] = signal("(condition " + to_string(c) + ")");
+            writtenNodes.push_back(conditionNodes[c]);
+        }
+        for (size_t c = 0; c < module.conditionals.size(); ++c) {
+            const RtlConditional& conditional = module.conditionals[c];
+            bool combinational = conditional.process < 0 ||
+                module.processes[conditional.process].kind == ProcessKind::Combinational;
+            module.forEachSignal(conditional.condition, [&](const string& name, uint32_t index) {
+                dependencies.push_back({ signalAt(name, index), conditionNodes[c], -1, combinational });
+            });
+            if (conditional.branch >= 0) {
+                dependencies.push_back({ conditionNodes[module.branches[conditional.branch].conditional], conditionNodes[c],
+                    -1, combinational });
+            }
+        }
+
+        // Local logic: each target depends on its value and on the conditions of every enclosing branch
+        for (size_t a = 0; a < module.assignments.size(); ++a) {
+            const RtlAssignment& assignment = module.assignments[a];
+            bool combinational = assignment.process < 0 ||
+                module.processes[assignment.process].kind == ProcessKind::Combinational;
+
+            vector<int> reads;
+            module.forEachSignal(assignment.value, [&](const string& name, uint32_t index) { reads.push_back(signalAt(name, index)); });
+            if (assignment.branch >= 0) {
+                reads.push_back(conditionNodes[module.branches[assignment.branch].conditional]);
+            }
+            bool producesX = containsXLiteral(module, assignment.value);
+
+            module.forEachTarget(assignment.target, [&](const string& name, uint32_t index) {
+                int target = signalAt(name, index);
+                writtenNodes.push_back(target);
+                for (int read : reads) {
+                    dependencies.push_back({ read, target, -1, combinational });
+                }
+                if (producesX) {
+                    xSources.push_back(target);
+                }
+                // One driver per continuous assign, one per process however often it assigns the target
+                vector<Driver>& targetDrivers = drivers[target];
+                string description = assignment.process < 0 ? "assign at line " + to_string(assignment.line)
+                    : "always/initial block at line " + to_string(module.processes[assignment.process].line);
+                bool seen = false;
+                for (const auto& driver : targetDrivers) {
+                    seen = seen || driver.description == description;
+                }
+                if (!seen) {
+                    targetDrivers.push_back({ description, false, assignment.line });
+                }
+            });
+        }
+
+        // Child instances: compose their summaries at the connected nets
+        struct XOrigin {
+            int line;
+            size_t count;
+            string message;
+        };
+        unordered_map<string, XOrigin> xFromChildren;
+        vector<pair<int, int>> instanceInputs;  // (signal, instance) pairs that feed an instance input
+        unordered_set<int> possiblyDriven;      // Connected where the direction is not known (black boxes,
+                                                // unknown or inout pins), so they may be driven from there
+        auto markPossiblyDriven = [&](const RtlExpression& actual) {
+            module.forEachSignal(actual, [&](const string& name, uint32_t index) {
+                int id = signalAt(name, index);
+                possiblyDriven.insert(id);
+                writtenNodes.push_back(id);
+            });
+        };
+        for (size_t i = 0; i < module.instances.size(); ++i) {
+            const RtlInstance& instance = module.instances[i];
+            if (inProgress.count(instance.moduleName)) {
+                report(module, "Recursive instantiation of module " + instance.moduleName + " by instance " +
+                    instance.name, instance.line);
+                for (const auto& connection : instance.connections) {
+                    markPossiblyDriven(connection.actual);
+                }
+                continue;
+            }
+            const ModuleSummary& child = summarize(instance.moduleName);
+            summary.instanceCount += 1 + child.instanceCount;
+            if (child.blackBox) {
+                for (const auto& connection : instance.connections) {
+                    markPossiblyDriven(connection.actual);
+                }
+                continue;
+            }
+
+            // Signals on each child port
+            vector<vector<int>> portSignals(child.ports.size());
+            for (size_t c = 0; c < instance.connections.size(); ++c) {
+                const RtlConnection& connection = instance.connections[c];
+                int port = connection.port.empty() ? static_cast<int>(c) : -1;
+                for (size_t p = 0; port < 0 && p < child.ports.size(); ++p) {
+                    if (child.ports[p].name == connection.port) {
+                        port = static_cast<int>(p);
+                    }
+                }
+                if (port < 0 || port >= static_cast<int>(child.ports.size())) {
+                    report(module, "Instance " + instance.name + " connects unknown port " +
+                        (connection.port.empty() ? "#" + to_string(c + 1) : connection.port) + " of " +
+                        instance.moduleName, instance.line);
+                    markPossiblyDriven(connection.actual);
+                    continue;
+                }
+                if (child.ports[port].direction == PinDirection::Unknown || child.ports[port].direction == PinDirection::Inout) {
+                    markPossiblyDriven(connection.actual);
+                }
+                module.forEachSignal(connection.actual, [&](const string& name, uint32_t index) {
+                    portSignals[port].push_back(signalAt(name, index));
+                });
+
+                // Width check for plain identifiers with a known declared width
+                const RtlExpression& actual = connection.actual;
+                if (actual.end - actual.begin == 1 && module.tokens[actual.begin].kind == TokenKind::Identifier) {
+                    auto width = module.widths.find(module.tokens[actual.begin].text.str());
+                    int portWidth = child.ports[port].width;
+                    if (width != module.widths.end() && width->second > 0 && portWidth > 0 && width->second != portWidth) {
+                        report(module, "Width mismatch on instance " + instance.name + " port " + child.ports[port].name +
+                            ": port is " + to_string(portWidth) + " bit(s), " + width->first + " is " +
+                            to_string(width->second) + " bit(s)", instance.line);
+                    }
+                }
+            }
+
+            for (size_t p = 0; p < child.ports.size(); ++p) {
+                if (child.ports[p].direction == PinDirection::Input) {
+                    for (int input : portSignals[p]) {
+                        instanceInputs.emplace_back(input, static_cast<int>(i));
+                    }
+                    continue;
+                }
+                if (child.ports[p].direction != PinDirection::Output) {
+                    continue;
+                }
+                for (int output : portSignals[p]) {
+                    writtenNodes.push_back(output);
+                    if (child.driven[p]) {
+                        drivers[output].push_back({ "instance " + instance.name + " port " + child.ports[p].name, true,
+                            instance.line });
+                    }
+                    for (int input : child.combinationalInputs[p]) {
+                        for (int source : portSignals[input]) {
+                            dependencies.push_back({ source, output, static_cast<int>(i), true });
+                        }
+                    }
+                    if (child.producesX[p]) {
+                        xSources.push_back(output);
+                        string key = instance.moduleName + "." + child.ports[p].name;
+                        auto origin = xFromChildren.find(key);
+                        if (origin == xFromChildren.end()) {
+                            xFromChildren.emplace(key, XOrigin{ instance.line, 1, "X produced in " + instance.moduleName +
+                                " reaches " + names[output] + " through output " + child.ports[p].name + " of instance " +
+                                instance.name });
+                        }
+                        else {
+                            ++origin->second.count;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Written nodes per signal: the whole signal, plus constant selects sorted by low bit. widest bounds
+        // how far back a lookup has to start, so bit-level buses resolve each read in logarithmic time.
+        struct WrittenSelects {
+            int whole = -1;
+            vector<pair<int, int>> byLow;  // (low, node)
+            int widest = 1;
+        };
+        vector<bool> isWritten(names.size(), false);
+        vector<WrittenSelects> written(baseNodes.size());
+        for (int id : writtenNodes) {
+            if (isWritten[id]) {
+                continue;
+            }
+            isWritten[id] = true;
+            WrittenSelects& selects = written[nodeBase[id]];
+            if (nodeRange[id].first < 0) {
+                selects.whole = id;
+            }
+            else {
+                selects.byLow.emplace_back(nodeRange[id].first, id);
+                selects.widest = max(selects.widest, nodeRange[id].second - nodeRange[id].first + 1);
+            }
+        }
+        for (auto& selects : written) {
+            sort(selects.byLow.begin(), selects.byLow.end());
+        }
+        // Calls visit(node) for every written node whose value the node read reads
+        auto forEachSource = [&](int read, const function<void(int)>& visit) {
+            const WrittenSelects& selects = written[nodeBase[read]];
+            if (selects.whole >= 0) {
+                visit(selects.whole);
+            }
+            const int low = nodeRange[read].first;
+            const int high = nodeRange[read].second;
+            auto it = low < 0 ? selects.byLow.begin()
+                : lower_bound(selects.byLow.begin(), selects.byLow.end(), make_pair(low - selects.widest + 1, INT32_MIN));
+            for (; it != selects.byLow.end() && (low < 0 || it->first <= high); ++it) {
+                if (low < 0 || nodeRange[it->second].second >= low) {
+                    visit(it->second);
+                }
+            }
+        };
+
+        vector<vector<Edge>> graph(names.size());
+        for (const Dependency& dependency : dependencies) {
+            forEachSource(dependency.from, [&](int source) {
+                if (source != dependency.to || dependency.combinational) {
+                    graph[source].push_back({ dependency.to, dependency.instance, dependency.combinational });
+                }
+            });
+        }
+
+        checkLoops(module, names, graph);
+
+        // X propagation through local logic and child port-to-port paths
+        vector<bool> carriesX(names.size(), false);
+        vector<int> worklist;
+        for (int source : xSources) {
+            if (!carriesX[source]) {
+                carriesX[source] = true;
+                worklist.push_back(source);
+            }
+        }
+        while (!worklist.empty()) {
+            int current = worklist.back();
+            worklist.pop_back();
+            for (const Edge& edge : graph[current]) {
+                if (!carriesX[edge.to]) {
+                    carriesX[edge.to] = true;
+                    worklist.push_back(edge.to);
+                }
+            }
+        }
+        for (const auto& origin : xFromChildren) {
+            report(module, origin.second.message + (origin.second.count > 1
+                ? " (and " + to_string(origin.second.count - 1) + " more instance(s))" : ""), origin.second.line);
+        }
+        unordered_set<int> reportedXInputs;
+        for (const auto& input : instanceInputs) {
+            bool readsX = false;
+            forEachSource(input.first, [&](int source) { readsX = readsX || carriesX[source]; });
+            if (readsX && reportedXInputs.insert(input.second).second) {
+                const RtlInstance& instance = module.instances[input.second];
+                report(module, "X can reach instance " + instance.name + " (" + instance.moduleName + ") through " +
+                    names[input.first], instance.line);
+            }
+        }
+
+        // Drivers that meet across the hierarchy; purely local conflicts are left to MultiDrivenBus. A
+        // constant select also conflicts with drivers of its whole signal, but not with disjoint selects.
+        for (const auto& entry : drivers) {
+            vector<Driver> netDrivers = entry.second;
+            int whole = written[nodeBase[entry.first]].whole;
+            if (nodeRange[entry.first].first >= 0 && whole >= 0 && drivers.count(whole)) {
+                for (const auto& driver : drivers[whole]) {
+                    bool seen = false;
+                    for (const auto& existing : netDrivers) {
+                        seen = seen || existing.description == driver.description;
+                    }
+                    if (!seen) {
+                        netDrivers.push_back(driver);
+                    }
+                }
+            }
+            bool crossesHierarchy = false;
+            for (const auto& driver : netDrivers) {
+                crossesHierarchy = crossesHierarchy || driver.fromInstance;
+            }
+            if (netDrivers.size() > 1 && crossesHierarchy) {
+                string message = "Net " + names[entry.first] + " has " + to_string(netDrivers.size()) + " drivers: ";
+                for (size_t d = 0; d < netDrivers.size(); ++d) {
+                    message += (d ? ", " : "") + netDrivers[d].description;
+                }
+                report(module, message, netDrivers.back().line);
+            }
+        }
+
+        // Port-to-port summary: which inputs reach each output combinationally, X and driven outputs. An
+        // output counts when any select of it does.
+        const size_t portCount = module.ports.size();
+        summary.combinationalInputs.resize(portCount);
+        summary.producesX.assign(portCount, false);
+        summary.driven.assign(portCount, false);
+        vector<int> visitedBy(names.size(), -1);
+        for (size_t p = 0; p < portCount; ++p) {
+            if (module.ports[p].direction != PinDirection::Input) {
+                continue;
+            }
+            int start = ids[module.ports[p].name];
+            worklist.assign(1, start);
+            visitedBy[start] = static_cast<int>(p);
+            while (!worklist.empty()) {
+                int current = worklist.back();
+                worklist.pop_back();
+                for (const Edge& edge : graph[current]) {
+                    if (edge.combinational && visitedBy[edge.to] != static_cast<int>(p)) {
+                        visitedBy[edge.to] = static_cast<int>(p);
+                        worklist.push_back(edge.to);
+                    }
+                }
+            }
+            for (size_t q = 0; q < portCount; ++q) {
+                if (module.ports[q].direction != PinDirection::Output) {
+                    continue;
+                }
+                bool reached = false;
+                for (int id : baseNodes[baseIds[module.ports[q].name]]) {
+                    reached = reached || visitedBy[id] == static_cast<int>(p);
+                }
+                if (reached) {
+                    summary.combinationalInputs[q].push_back(static_cast<int>(p));
+                }
+            }
+        }
+        bool hasContents = !module.assignments.empty() || !module.instances.empty();
+        for (size_t p = 0; p < portCount; ++p) {
+            if (module.ports[p].direction != PinDirection::Output) {
+                continue;
+            }
+            for (int id : baseNodes[baseIds[module.ports[p].name]]) {
+                summary.producesX[p] = summary.producesX[p] || carriesX[id];
+                summary.driven[p] = summary.driven[p] || drivers.count(id) > 0 || possiblyDriven.count(id) > 0;
+            }
+            if (!summary.driven[p] && hasContents) {
+                report(module, "Output port " + module.ports[p].name + " is never driven", module.ports[p].line);
+            }
+        }
+        return summary;
+    }
+
+public:
+    HierarchyElaborator(const RtlDesign& design, const CellLibrary& library) : design(design), library(library) {}
+
+    // Returns false when the top module is not defined in any of the given files
+    bool run(const string& top) {
+        if (!design.find(top)) {
+            return false;
+        }
+        elaboratedInstances = 1 + summarize(top).instanceCount;
+        return true;
+    }
+
+    void reportViolations() const {
+        cout << "Hierarchy: " << elaboratedInstances << " instance(s) elaborated from " << analyzedModules
+            << " module analysis(es)" << endl;
+        if (!blackBoxes.empty()) {
+            cout << "Note: " << blackBoxes.size() << " module(s) without a definition treated as black boxes:";
+            for (const auto& name : blackBoxes) {
+                cout << " " << name;
+            }
+            cout << endl;
+        }
+        if (violations.empty()) {
+            cout << "No violations found!" << endl;
+        }
+        else {
+            cout << "Violations found:" << endl;
+            for (const auto& violation : violations) {
+                cout << "Line " << (violation.line ? to_string(violation.line) : "unknown") << ": " << violation.message << endl;
+            }
+        }
+    }
+};
+
+// Parses a non-negative numeric option value, exiting with a usage error otherwise
+long long parseBudgetValue(const string& option, const char* value) {
+    char* end = nullptr;
+    long long parsed = value ? strtoll(value, &end, 10) : -1;
+    if (!value || *end != '\0' || parsed < 0) {
+        cerr << "Error: " << option << " expects a non-negative number" << endl;
+        exit(EXIT_FAILURE);
+    }
+    return parsed;
+}
+
+// Main Program
+int main(int argc, char* argv[]) {
+    RuleBudget budget;
+    CellLibrary cellLibrary;
+    enum class InputMode { Auto, Rtl, Netlist } mode = InputMode::Auto;
+    string topModule;
+    vector<string> filenames;
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (arg == "--rule-time-ms") {
+            budget.maxRuleMillis = parseBudgetValue(arg, value); ++i;
+        }
+        else if (arg == "--file-time-ms") {
+            budget.maxFileMillis = parseBudgetValue(arg, value); ++i;
+        }
+        else if (arg == "--rule-steps") {
+            budget.maxRuleSteps = static_cast<size_t>(parseBudgetValue(arg, value)); ++i;
+        }
+        else if (arg == "--file-steps") {
+            budget.maxFileSteps = static_cast<size_t>(parseBudgetValue(arg, value)); ++i;
+        }
+        else if (arg == "--rule-max-bytes") {
+            budget.maxSubjectBytes = static_cast<size_t>(parseBudgetValue(arg, value)); ++i;
+        }
+        else if (arg == "--rule-max-depth") {
+            budget.maxRecursionDepth = static_cast<size_t>(parseBudgetValue(arg, value)); ++i;
+        }
+        else if (arg == "--cell-lib") {
+            if (!value) {
+                cerr << "Error: --cell-lib expects a Liberty or JSON file" << endl;
+                return EXIT_FAILURE;
+            }
+            cellLibrary.load(value); ++i;
+        }
+        else if (arg == "--netlist") {
+            mode = InputMode::Netlist;
+        }
+        else if (arg == "--rtl") {
+            mode = InputMode::Rtl;
+        }
+        else if (arg == "--top") {
+            if (!value) {
+                cerr << "Error: --top expects a module name" << endl;
+                return EXIT_FAILURE;
+            }
+            topModule = value; ++i;
+        }
+        else {
+            filenames.push_back(arg);
+        }
+    }
+
+    if (filenames.empty()) {
+        cerr << "Usage: " << argv[0] << " [--rule-time-ms N] [--file-time-ms N] [--rule-steps N] [--file-steps N] "
+            << "[--rule-max-bytes N] [--rule-max-depth N] [--netlist | --rtl] [--cell-lib FILE]... [--top MODULE] <verilog_file>..." << endl;
+        cerr << "A budget of 0 disables that limit." << endl;
+        cerr << "Gate-level netlists are detected automatically when most instances are --cell-lib cells; "
+            << "--netlist/--rtl force the mode." << endl;
+        cerr << "--cell-lib loads cell pin directions from a Liberty (.lib) or JSON (.json) file." << endl;
+        cerr << "--top elaborates the hierarchy below MODULE across all given files." << endl;
+        return EXIT_FAILURE;
+    }
+
+    vector<pair<string, BudgetHit>> budgetHits;
+    RtlDesign design;
+    for (const auto& filename : filenames) {
+        if (filenames.size() > 1) {
+            cout << "== " << filename << endl;
+        }
+
+        // Parse Verilog File
+        VerilogParser parser(filename);
+
+        // Structural netlists skip the regex rules and use the connectivity graph instead
+        if (mode == InputMode::Netlist || (mode == InputMode::Auto && looksLikeNetlist(parser.getSource(), cellLibrary))) {
+            NetlistChecker netlistChecker(cellLibrary);
+            netlistChecker.runChecks(parser.getSource());
+            netlistChecker.reportViolations();
+        }
+        else {
+            // Perform Static Checks
+            StaticChecker checker(parser.getLines(), budget);
+            checker.runChecks();
+
+            // Report Violations
+            checker.reportViolations();
+
+            for (const auto& hit : checker.getBudgetHits()) {
+                budgetHits.emplace_back(filename, hit);
+            }
+        }
+
+        // Keep the source for hierarchical elaboration once the per-file checks are done with it
+        if (!topModule.empty()) {
+            design.addSource(filename, parser.releaseSource(), budget.maxRecursionDepth);
+        }
+    }
+
+    // Hierarchical checks across all files, composing one summary per module definition
+    if (!topModule.empty()) {
+        cout << endl << "== Hierarchy from top module " << topModule << endl;
+        HierarchyElaborator elaborator(design, cellLibrary);
+        if (!elaborator.run(topModule)) {
+            cerr << "Error: top module " << topModule << " is not defined in the given files" << endl;
+            return EXIT_FAILURE;
+        }
+        elaborator.reportViolations();
+    }
+
+    // Summarize budget hits so the inputs that need engine work are easy to find
+    if (!budgetHits.empty()) {
+        cout << endl << "Budget summary: " << budgetHits.size() << " rule run(s) aborted or input(s) skipped" << endl;
+        for (const auto& entry : budgetHits) {
+            const BudgetHit& hit = entry.second;
+            cout << "  " << entry.first << ":" << (hit.line ? to_string(hit.line) : "unknown")
+                << ": " << hit.rule << ": " << hit.reason << endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+// Parameter-driven dead branches: MODE == 2 && EN folds to false, sel is always 2, st is 1 or 2, L is 0
+module dead_params(input clk, input EN, output reg [3:0] q);
+    parameter MODE = 1;
+    localparam WIDE = MODE * 2;
+    wire [1:0] sel;
+    assign sel = WIDE[1:0];
+    reg [1:0] st;
+    always @(posedge clk) begin
+        if (MODE == 2 && EN)
+            q <= 4'd1;
+        else if (EN)
+            q <= 4'd2;
+        else
+            q <= 4'd3;
+        case (sel)
+            2'd0: q <= 0;
+            2'd2: q <= 1;
+            2'd3: q <= 2;
+        endcase
+        st <= 2'd1;
+        if (st == 2'd1) st <= 2'd2;
+        case (st)
+            2'd0: q <= 0;
+            2'd1: q <= 0;
+            2'd2: q <= 0;
+            2'd3: q <= 0;
+            default: q <= 0;
+        endcase
+    end
+    localparam L = 0;
+    always @(*) begin
+        if (L) q = 1;
+        else q = 2;
+    end
+endmodule
@@ -0,0 +1,21 @@
+// None of these branches is dead: signed comparisons, parameter ranges and gate outputs are modelled
+module dead_signed (input clk, input a, output reg [3:0] y);
+    parameter OFFSET = -1;
+    localparam [1:0] M = 5;           // truncated to 2'b01
+    localparam signed [7:0] LOW = -8'sd3;
+    localparam [7:0] WIDE = -1;       // unsigned 8'hff
+    integer count = -2;
+    wire n;
+    not g (n, 1'b0);
+
+    always @* begin
+        y = 4'd0;
+        if (OFFSET < 0) y = 4'd1;
+        if (M == 1) y = 4'd2;
+        if (LOW < 8'sd0) y = 4'd3;
+        if (WIDE > 8'd128) y = 4'd4;
+        if (count < 0) y = 4'd5;
+        if (n) y = 4'd6;
+        if (-7 / 2 == -3) y = 4'd7;
+    end
+endmodule
@@ -0,0 +1,41 @@
+// Signals also assigned in a for header, a task and a generate block are unknown: only the duplicate
+// case item at line 37 is unreachable
+module dead_unmodelled (input clk, input [1:0] sel, input go, output reg [3:0] q);
+    integer i;
+    reg [1:0] nxt;
+    reg [1:0] gen_r;
+    initial i = 0;
+    always @(posedge clk) begin
+        for (i = 0; i < 4; i = i + 1)
+            if (i == 3) q <= 4'd1;
+    end
+
+    task upd;
+        begin
+            nxt = nxt + 1;
+        end
+    endtask
+
+    always @(posedge clk) begin
+        nxt = 0;
+        upd;
+        if (nxt == 2) q <= 4'd2;
+    end
+
+    initial gen_r = 0;
+    generate
+        if (1) begin : g
+            always @(posedge clk) gen_r <= gen_r + 1;
+        end
+    endgenerate
+    always @* if (gen_r == 2'd3) q = 4'd3;
+
+    always @* begin
+        case (sel)
+            2'd0: q = 4'd4;
+            2'd1: q = 4'd5;
+            2'd0: q = 4'd6;     // duplicate of the first item: never taken
+            default: q = 4'd7;
+        endcase
+    end
+endmodule
@@ -0,0 +1,16 @@
+// Run with --top adder4 hierarchy_adder.v: the carry chain and sum bits are disjoint selects, so no loop
+// or multiple-driver report is expected
+module fa (input a, input b, input ci, output s, output co);
+    assign s = a ^ b ^ ci;
+    assign co = (a & b) | (ci & (a ^ b));
+endmodule
+
+module adder4 (input [3:0] a, input [3:0] b, input cin, output [3:0] s, output cout);
+    wire [4:0] c;
+    assign c[0] = cin;
+    fa u0 (.a(a[0]), .b(b[0]), .ci(c[0]), .s(s[0]), .co(c[1]));
+    fa u1 (.a(a[1]), .b(b[1]), .ci(c[1]), .s(s[1]), .co(c[2]));
+    fa u2 (.a(a[2]), .b(b[2]), .ci(c[2]), .s(s[2]), .co(c[3]));
+    fa u3 (.a(a[3]), .b(b[3]), .ci(c[3]), .s(s[3]), .co(c[4]));
+    assign cout = c[4];
+endmodule
@@ -0,0 +1,12 @@
+module inv (input a, output y);
+    assign y = ~a;
+endmodule
+
+module xgen #(parameter W = 4) (input [3:0] d, output [3:0] q, output z);
+    assign q = 4'bxxxx;
+    assign z = d[0];
+endmodule
+
+module reg1 (input clk, input d, output reg q, output nodrv);   // nodrv is never driven
+    always @(posedge clk) q <= d;
+endmodule
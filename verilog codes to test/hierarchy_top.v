@@ -0,0 +1,15 @@
+// Run with --top hier_top hierarchy_top.v hierarchy_child.v [--cell-lib netlist_cells.lib]
+module hier_top (input clk, input [7:0] in, output o, output [3:0] w, output p, output t);
+    wire a, b, c;
+    wire [7:0] bus;
+    inv u1 (.a(a), .y(b));
+    inv u2 (.a(b), .y(a));              // loop through child ports
+    xgen g1 (.d(bus), .q(w), .z(c));    // width mismatch; X source
+    reg1 r1 (.clk(clk), .d(w[0]), .q(o), .nodrv());
+    inv u3 (.a(w[1]), .y(c));           // second driver of c
+    bbox u4 (.in(in[2]), .out(p));      // black box may drive p
+    TIEHIX1 u5 (.Y(t));                 // pin without a direction may drive t
+    always @* begin
+        if (in[0]) bus = in; else bus = 8'h00;
+    end
+endmodule
@@ -0,0 +1,1010 @@
+// A 1000-entry clocked ROM case must not stop the latch check of the always @* block after it
+module rom(input clk, input [9:0] a, input c, input d, output reg [7:0] q, output reg y);
+always @(posedge clk) begin
+ case (a)
+  10'd0: q <= 8'd0;
+  10'd1: q <= 8'd1;
+  10'd2: q <= 8'd2;
+  10'd3: q <= 8'd3;
+  10'd4: q <= 8'd4;
+  10'd5: q <= 8'd5;
+  10'd6: q <= 8'd6;
+  10'd7: q <= 8'd7;
+  10'd8: q <= 8'd8;
+  10'd9: q <= 8'd9;
+  10'd10: q <= 8'd10;
+  10'd11: q <= 8'd11;
+  10'd12: q <= 8'd12;
+  10'd13: q <= 8'd13;
+  10'd14: q <= 8'd14;
+  10'd15: q <= 8'd15;
+  10'd16: q <= 8'd16;
+  10'd17: q <= 8'd17;
+  10'd18: q <= 8'd18;
+  10'd19: q <= 8'd19;
+  10'd20: q <= 8'd20;
+  10'd21: q <= 8'd21;
+  10'd22: q <= 8'd22;
+  10'd23: q <= 8'd23;
+  10'd24: q <= 8'd24;
+  10'd25: q <= 8'd25;
+  10'd26: q <= 8'd26;
+  10'd27: q <= 8'd27;
+  10'd28: q <= 8'd28;
+  10'd29: q <= 8'd29;
+  10'd30: q <= 8'd30;
+  10'd31: q <= 8'd31;
+  10'd32: q <= 8'd32;
+  10'd33: q <= 8'd33;
+  10'd34: q <= 8'd34;
+  10'd35: q <= 8'd35;
+  10'd36: q <= 8'd36;
+  10'd37: q <= 8'd37;
+  10'd38: q <= 8'd38;
+  10'd39: q <= 8'd39;
+  10'd40: q <= 8'd40;
+  10'd41: q <= 8'd41;
+  10'd42: q <= 8'd42;
+  10'd43: q <= 8'd43;
+  10'd44: q <= 8'd44;
+  10'd45: q <= 8'd45;
+  10'd46: q <= 8'd46;
+  10'd47: q <= 8'd47;
+  10'd48: q <= 8'd48;
+  10'd49: q <= 8'd49;
+  10'd50: q <= 8'd50;
+  10'd51: q <= 8'd51;
+  10'd52: q <= 8'd52;
+  10'd53: q <= 8'd53;
+  10'd54: q <= 8'd54;
+  10'd55: q <= 8'd55;
+  10'd56: q <= 8'd56;
+  10'd57: q <= 8'd57;
+  10'd58: q <= 8'd58;
+  10'd59: q <= 8'd59;
+  10'd60: q <= 8'd60;
+  10'd61: q <= 8'd61;
+  10'd62: q <= 8'd62;
+  10'd63: q <= 8'd63;
+  10'd64: q <= 8'd64;
+  10'd65: q <= 8'd65;
+  10'd66: q <= 8'd66;
+  10'd67: q <= 8'd67;
+  10'd68: q <= 8'd68;
+  10'd69: q <= 8'd69;
+  10'd70: q <= 8'd70;
+  10'd71: q <= 8'd71;
+  10'd72: q <= 8'd72;
+  10'd73: q <= 8'd73;
+  10'd74: q <= 8'd74;
+  10'd75: q <= 8'd75;
+  10'd76: q <= 8'd76;
+  10'd77: q <= 8'd77;
+  10'd78: q <= 8'd78;
+  10'd79: q <= 8'd79;
+  10'd80: q <= 8'd80;
+  10'd81: q <= 8'd81;
+  10'd82: q <= 8'd82;
+  10'd83: q <= 8'd83;
+  10'd84: q <= 8'd84;
+  10'd85: q <= 8'd85;
+  10'd86: q <= 8'd86;
+  10'd87: q <= 8'd87;
+  10'd88: q <= 8'd88;
+  10'd89: q <= 8'd89;
+  10'd90: q <= 8'd90;
+  10'd91: q <= 8'd91;
+  10'd92: q <= 8'd92;
+  10'd93: q <= 8'd93;
+  10'd94: q <= 8'd94;
+  10'd95: q <= 8'd95;
+  10'd96: q <= 8'd96;
+  10'd97: q <= 8'd97;
+  10'd98: q <= 8'd98;
+  10'd99: q <= 8'd99;
+  10'd100: q <= 8'd100;
+  10'd101: q <= 8'd101;
+  10'd102: q <= 8'd102;
+  10'd103: q <= 8'd103;
+  10'd104: q <= 8'd104;
+  10'd105: q <= 8'd105;
+  10'd106: q <= 8'd106;
+  10'd107: q <= 8'd107;
+  10'd108: q <= 8'd108;
+  10'd109: q <= 8'd109;
+  10'd110: q <= 8'd110;
+  10'd111: q <= 8'd111;
+  10'd112: q <= 8'd112;
+  10'd113: q <= 8'd113;
+  10'd114: q <= 8'd114;
+  10'd115: q <= 8'd115;
+  10'd116: q <= 8'd116;
+  10'd117: q <= 8'd117;
+  10'd118: q <= 8'd118;
+  10'd119: q <= 8'd119;
+  10'd120: q <= 8'd120;
+  10'd121: q <= 8'd121;
+  10'd122: q <= 8'd122;
+  10'd123: q <= 8'd123;
+  10'd124: q <= 8'd124;
+  10'd125: q <= 8'd125;
+  10'd126: q <= 8'd126;
+  10'd127: q <= 8'd127;
+  10'd128: q <= 8'd128;
+  10'd129: q <= 8'd129;
+  10'd130: q <= 8'd130;
+  10'd131: q <= 8'd131;
+  10'd132: q <= 8'd132;
+  10'd133: q <= 8'd133;
+  10'd134: q <= 8'd134;
+  10'd135: q <= 8'd135;
+  10'd136: q <= 8'd136;
+  10'd137: q <= 8'd137;
+  10'd138: q <= 8'd138;
+  10'd139: q <= 8'd139;
+  10'd140: q <= 8'd140;
+  10'd141: q <= 8'd141;
+  10'd142: q <= 8'd142;
+  10'd143: q <= 8'd143;
+  10'd144: q <= 8'd144;
+  10'd145: q <= 8'd145;
+  10'd146: q <= 8'd146;
+  10'd147: q <= 8'd147;
+  10'd148: q <= 8'd148;
+  10'd149: q <= 8'd149;
+  10'd150: q <= 8'd150;
+  10'd151: q <= 8'd151;
+  10'd152: q <= 8'd152;
+  10'd153: q <= 8'd153;
+  10'd154: q <= 8'd154;
+  10'd155: q <= 8'd155;
+  10'd156: q <= 8'd156;
+  10'd157: q <= 8'd157;
+  10'd158: q <= 8'd158;
+  10'd159: q <= 8'd159;
+  10'd160: q <= 8'd160;
+  10'd161: q <= 8'd161;
+  10'd162: q <= 8'd162;
+  10'd163: q <= 8'd163;
+  10'd164: q <= 8'd164;
+  10'd165: q <= 8'd165;
+  10'd166: q <= 8'd166;
+  10'd167: q <= 8'd167;
+  10'd168: q <= 8'd168;
+  10'd169: q <= 8'd169;
+  10'd170: q <= 8'd170;
+  10'd171: q <= 8'd171;
+  10'd172: q <= 8'd172;
+  10'd173: q <= 8'd173;
+  10'd174: q <= 8'd174;
+  10'd175: q <= 8'd175;
+  10'd176: q <= 8'd176;
+  10'd177: q <= 8'd177;
+  10'd178: q <= 8'd178;
+  10'd179: q <= 8'd179;
+  10'd180: q <= 8'd180;
+  10'd181: q <= 8'd181;
+  10'd182: q <= 8'd182;
+  10'd183: q <= 8'd183;
+  10'd184: q <= 8'd184;
+  10'd185: q <= 8'd185;
+  10'd186: q <= 8'd186;
+  10'd187: q <= 8'd187;
+  10'd188: q <= 8'd188;
+  10'd189: q <= 8'd189;
+  10'd190: q <= 8'd190;
+  10'd191: q <= 8'd191;
+  10'd192: q <= 8'd192;
+  10'd193: q <= 8'd193;
+  10'd194: q <= 8'd194;
+  10'd195: q <= 8'd195;
+  10'd196: q <= 8'd196;
+  10'd197: q <= 8'd197;
+  10'd198: q <= 8'd198;
+  10'd199: q <= 8'd199;
+  10'd200: q <= 8'd200;
+  10'd201: q <= 8'd201;
+  10'd202: q <= 8'd202;
+  10'd203: q <= 8'd203;
+  10'd204: q <= 8'd204;
+  10'd205: q <= 8'd205;
+  10'd206: q <= 8'd206;
+  10'd207: q <= 8'd207;
+  10'd208: q <= 8'd208;
+  10'd209: q <= 8'd209;
+  10'd210: q <= 8'd210;
+  10'd211: q <= 8'd211;
+  10'd212: q <= 8'd212;
+  10'd213: q <= 8'd213;
+  10'd214: q <= 8'd214;
+  10'd215: q <= 8'd215;
+  10'd216: q <= 8'd216;
+  10'd217: q <= 8'd217;
+  10'd218: q <= 8'd218;
+  10'd219: q <= 8'd219;
+  10'd220: q <= 8'd220;
+  10'd221: q <= 8'd221;
+  10'd222: q <= 8'd222;
+  10'd223: q <= 8'd223;
+  10'd224: q <= 8'd224;
+  10'd225: q <= 8'd225;
+  10'd226: q <= 8'd226;
+  10'd227: q <= 8'd227;
+  10'd228: q <= 8'd228;
+  10'd229: q <= 8'd229;
+  10'd230: q <= 8'd230;
+  10'd231: q <= 8'd231;
+  10'd232: q <= 8'd232;
+  10'd233: q <= 8'd233;
+  10'd234: q <= 8'd234;
+  10'd235: q <= 8'd235;
+  10'd236: q <= 8'd236;
+  10'd237: q <= 8'd237;
+  10'd238: q <= 8'd238;
+  10'd239: q <= 8'd239;
+  10'd240: q <= 8'd240;
+  10'd241: q <= 8'd241;
+  10'd242: q <= 8'd242;
+  10'd243: q <= 8'd243;
+  10'd244: q <= 8'd244;
+  10'd245: q <= 8'd245;
+  10'd246: q <= 8'd246;
+  10'd247: q <= 8'd247;
+  10'd248: q <= 8'd248;
+  10'd249: q <= 8'd249;
+  10'd250: q <= 8'd250;
+  10'd251: q <= 8'd251;
+  10'd252: q <= 8'd252;
+  10'd253: q <= 8'd253;
+  10'd254: q <= 8'd254;
+  10'd255: q <= 8'd255;
+  10'd256: q <= 8'd0;
+  10'd257: q <= 8'd1;
+  10'd258: q <= 8'd2;
+  10'd259: q <= 8'd3;
+  10'd260: q <= 8'd4;
+  10'd261: q <= 8'd5;
+  10'd262: q <= 8'd6;
+  10'd263: q <= 8'd7;
+  10'd264: q <= 8'd8;
+  10'd265: q <= 8'd9;
+  10'd266: q <= 8'd10;
+  10'd267: q <= 8'd11;
+  10'd268: q <= 8'd12;
+  10'd269: q <= 8'd13;
+  10'd270: q <= 8'd14;
+  10'd271: q <= 8'd15;
+  10'd272: q <= 8'd16;
+  10'd273: q <= 8'd17;
+  10'd274: q <= 8'd18;
+  10'd275: q <= 8'd19;
+  10'd276: q <= 8'd20;
+  10'd277: q <= 8'd21;
+  10'd278: q <= 8'd22;
+  10'd279: q <= 8'd23;
+  10'd280: q <= 8'd24;
+  10'd281: q <= 8'd25;
+  10'd282: q <= 8'd26;
+  10'd283: q <= 8'd27;
+  10'd284: q <= 8'd28;
+  10'd285: q <= 8'd29;
+  10'd286: q <= 8'd30;
+  10'd287: q <= 8'd31;
+  10'd288: q <= 8'd32;
+  10'd289: q <= 8'd33;
+  10'd290: q <= 8'd34;
+  10'd291: q <= 8'd35;
+  10'd292: q <= 8'd36;
+  10'd293: q <= 8'd37;
+  10'd294: q <= 8'd38;
+  10'd295: q <= 8'd39;
+  10'd296: q <= 8'd40;
+  10'd297: q <= 8'd41;
+  10'd298: q <= 8'd42;
+  10'd299: q <= 8'd43;
+  10'd300: q <= 8'd44;
+  10'd301: q <= 8'd45;
+  10'd302: q <= 8'd46;
+  10'd303: q <= 8'd47;
+  10'd304: q <= 8'd48;
+  10'd305: q <= 8'd49;
+  10'd306: q <= 8'd50;
+  10'd307: q <= 8'd51;
+  10'd308: q <= 8'd52;
+  10'd309: q <= 8'd53;
+  10'd310: q <= 8'd54;
+  10'd311: q <= 8'd55;
+  10'd312: q <= 8'd56;
+  10'd313: q <= 8'd57;
+  10'd314: q <= 8'd58;
+  10'd315: q <= 8'd59;
+  10'd316: q <= 8'd60;
+  10'd317: q <= 8'd61;
+  10'd318: q <= 8'd62;
+  10'd319: q <= 8'd63;
+  10'd320: q <= 8'd64;
+  10'd321: q <= 8'd65;
+  10'd322: q <= 8'd66;
+  10'd323: q <= 8'd67;
+  10'd324: q <= 8'd68;
+  10'd325: q <= 8'd69;
+  10'd326: q <= 8'd70;
+  10'd327: q <= 8'd71;
+  10'd328: q <= 8'd72;
+  10'd329: q <= 8'd73;
+  10'd330: q <= 8'd74;
+  10'd331: q <= 8'd75;
+  10'd332: q <= 8'd76;
+  10'd333: q <= 8'd77;
+  10'd334: q <= 8'd78;
+  10'd335: q <= 8'd79;
+  10'd336: q <= 8'd80;
+  10'd337: q <= 8'd81;
+  10'd338: q <= 8'd82;
+  10'd339: q <= 8'd83;
+  10'd340: q <= 8'd84;
+  10'd341: q <= 8'd85;
+  10'd342: q <= 8'd86;
+  10'd343: q <= 8'd87;
+  10'd344: q <= 8'd88;
+  10'd345: q <= 8'd89;
+  10'd346: q <= 8'd90;
+  10'd347: q <= 8'd91;
+  10'd348: q <= 8'd92;
+  10'd349: q <= 8'd93;
+  10'd350: q <= 8'd94;
+  10'd351: q <= 8'd95;
+  10'd352: q <= 8'd96;
+  10'd353: q <= 8'd97;
+  10'd354: q <= 8'd98;
+  10'd355: q <= 8'd99;
+  10'd356: q <= 8'd100;
+  10'd357: q <= 8'd101;
+  10'd358: q <= 8'd102;
+  10'd359: q <= 8'd103;
+  10'd360: q <= 8'd104;
+  10'd361: q <= 8'd105;
+  10'd362: q <= 8'd106;
+  10'd363: q <= 8'd107;
+  10'd364: q <= 8'd108;
+  10'd365: q <= 8'd109;
+  10'd366: q <= 8'd110;
+  10'd367: q <= 8'd111;
+  10'd368: q <= 8'd112;
+  10'd369: q <= 8'd113;
+  10'd370: q <= 8'd114;
+  10'd371: q <= 8'd115;
+  10'd372: q <= 8'd116;
+  10'd373: q <= 8'd117;
+  10'd374: q <= 8'd118;
+  10'd375: q <= 8'd119;
+  10'd376: q <= 8'd120;
+  10'd377: q <= 8'd121;
+  10'd378: q <= 8'd122;
+  10'd379: q <= 8'd123;
+  10'd380: q <= 8'd124;
+  10'd381: q <= 8'd125;
+  10'd382: q <= 8'd126;
+  10'd383: q <= 8'd127;
+  10'd384: q <= 8'd128;
+  10'd385: q <= 8'd129;
+  10'd386: q <= 8'd130;
+  10'd387: q <= 8'd131;
+  10'd388: q <= 8'd132;
+  10'd389: q <= 8'd133;
+  10'd390: q <= 8'd134;
+  10'd391: q <= 8'd135;
+  10'd392: q <= 8'd136;
+  10'd393: q <= 8'd137;
+  10'd394: q <= 8'd138;
+  10'd395: q <= 8'd139;
+  10'd396: q <= 8'd140;
+  10'd397: q <= 8'd141;
+  10'd398: q <= 8'd142;
+  10'd399: q <= 8'd143;
+  10'd400: q <= 8'd144;
+  10'd401: q <= 8'd145;
+  10'd402: q <= 8'd146;
+  10'd403: q <= 8'd147;
+  10'd404: q <= 8'd148;
+  10'd405: q <= 8'd149;
+  10'd406: q <= 8'd150;
+  10'd407: q <= 8'd151;
+  10'd408: q <= 8'd152;
+  10'd409: q <= 8'd153;
+  10'd410: q <= 8'd154;
+  10'd411: q <= 8'd155;
+  10'd412: q <= 8'd156;
+  10'd413: q <= 8'd157;
+  10'd414: q <= 8'd158;
+  10'd415: q <= 8'd159;
+  10'd416: q <= 8'd160;
+  10'd417: q <= 8'd161;
+  10'd418: q <= 8'd162;
+  10'd419: q <= 8'd163;
+  10'd420: q <= 8'd164;
+  10'd421: q <= 8'd165;
+  10'd422: q <= 8'd166;
+  10'd423: q <= 8'd167;
+  10'd424: q <= 8'd168;
+  10'd425: q <= 8'd169;
+  10'd426: q <= 8'd170;
+  10'd427: q <= 8'd171;
+  10'd428: q <= 8'd172;
+  10'd429: q <= 8'd173;
+  10'd430: q <= 8'd174;
+  10'd431: q <= 8'd175;
+  10'd432: q <= 8'd176;
+  10'd433: q <= 8'd177;
+  10'd434: q <= 8'd178;
+  10'd435: q <= 8'd179;
+  10'd436: q <= 8'd180;
+  10'd437: q <= 8'd181;
+  10'd438: q <= 8'd182;
+  10'd439: q <= 8'd183;
+  10'd440: q <= 8'd184;
+  10'd441: q <= 8'd185;
+  10'd442: q <= 8'd186;
+  10'd443: q <= 8'd187;
+  10'd444: q <= 8'd188;
+  10'd445: q <= 8'd189;
+  10'd446: q <= 8'd190;
+  10'd447: q <= 8'd191;
+  10'd448: q <= 8'd192;
+  10'd449: q <= 8'd193;
+  10'd450: q <= 8'd194;
+  10'd451: q <= 8'd195;
+  10'd452: q <= 8'd196;
+  10'd453: q <= 8'd197;
+  10'd454: q <= 8'd198;
+  10'd455: q <= 8'd199;
+  10'd456: q <= 8'd200;
+  10'd457: q <= 8'd201;
+  10'd458: q <= 8'd202;
+  10'd459: q <= 8'd203;
+  10'd460: q <= 8'd204;
+  10'd461: q <= 8'd205;
+  10'd462: q <= 8'd206;
+  10'd463: q <= 8'd207;
+  10'd464: q <= 8'd208;
+  10'd465: q <= 8'd209;
+  10'd466: q <= 8'd210;
+  10'd467: q <= 8'd211;
+  10'd468: q <= 8'd212;
+  10'd469: q <= 8'd213;
+  10'd470: q <= 8'd214;
+  10'd471: q <= 8'd215;
+  10'd472: q <= 8'd216;
+  10'd473: q <= 8'd217;
+  10'd474: q <= 8'd218;
+  10'd475: q <= 8'd219;
+  10'd476: q <= 8'd220;
+  10'd477: q <= 8'd221;
+  10'd478: q <= 8'd222;
+  10'd479: q <= 8'd223;
+  10'd480: q <= 8'd224;
+  10'd481: q <= 8'd225;
+  10'd482: q <= 8'd226;
+  10'd483: q <= 8'd227;
+  10'd484: q <= 8'd228;
+  10'd485: q <= 8'd229;
+  10'd486: q <= 8'd230;
+  10'd487: q <= 8'd231;
+  10'd488: q <= 8'd232;
+  10'd489: q <= 8'd233;
+  10'd490: q <= 8'd234;
+  10'd491: q <= 8'd235;
+  10'd492: q <= 8'd236;
+  10'd493: q <= 8'd237;
+  10'd494: q <= 8'd238;
+  10'd495: q <= 8'd239;
+  10'd496: q <= 8'd240;
+  10'd497: q <= 8'd241;
+  10'd498: q <= 8'd242;
+  10'd499: q <= 8'd243;
+  10'd500: q <= 8'd244;
+  10'd501: q <= 8'd245;
+  10'd502: q <= 8'd246;
+  10'd503: q <= 8'd247;
+  10'd504: q <= 8'd248;
+  10'd505: q <= 8'd249;
+  10'd506: q <= 8'd250;
+  10'd507: q <= 8'd251;
+  10'd508: q <= 8'd252;
+  10'd509: q <= 8'd253;
+  10'd510: q <= 8'd254;
+  10'd511: q <= 8'd255;
+  10'd512: q <= 8'd0;
+  10'd513: q <= 8'd1;
+  10'd514: q <= 8'd2;
+  10'd515: q <= 8'd3;
+  10'd516: q <= 8'd4;
+  10'd517: q <= 8'd5;
+  10'd518: q <= 8'd6;
+  10'd519: q <= 8'd7;
+  10'd520: q <= 8'd8;
+  10'd521: q <= 8'd9;
+  10'd522: q <= 8'd10;
+  10'd523: q <= 8'd11;
+  10'd524: q <= 8'd12;
+  10'd525: q <= 8'd13;
+  10'd526: q <= 8'd14;
+  10'd527: q <= 8'd15;
+  10'd528: q <= 8'd16;
+  10'd529: q <= 8'd17;
+  10'd530: q <= 8'd18;
+  10'd531: q <= 8'd19;
+  10'd532: q <= 8'd20;
+  10'd533: q <= 8'd21;
+  10'd534: q <= 8'd22;
+  10'd535: q <= 8'd23;
+  10'd536: q <= 8'd24;
+  10'd537: q <= 8'd25;
+  10'd538: q <= 8'd26;
+  10'd539: q <= 8'd27;
+  10'd540: q <= 8'd28;
+  10'd541: q <= 8'd29;
+  10'd542: q <= 8'd30;
+  10'd543: q <= 8'd31;
+  10'd544: q <= 8'd32;
+  10'd545: q <= 8'd33;
+  10'd546: q <= 8'd34;
+  10'd547: q <= 8'd35;
+  10'd548: q <= 8'd36;
+  10'd549: q <= 8'd37;
+  10'd550: q <= 8'd38;
+  10'd551: q <= 8'd39;
+  10'd552: q <= 8'd40;
+  10'd553: q <= 8'd41;
+  10'd554: q <= 8'd42;
+  10'd555: q <= 8'd43;
+  10'd556: q <= 8'd44;
+  10'd557: q <= 8'd45;
+  10'd558: q <= 8'd46;
+  10'd559: q <= 8'd47;
+  10'd560: q <= 8'd48;
+  10'd561: q <= 8'd49;
+  10'd562: q <= 8'd50;
+  10'd563: q <= 8'd51;
+  10'd564: q <= 8'd52;
+  10'd565: q <= 8'd53;
+  10'd566: q <= 8'd54;
+  10'd567: q <= 8'd55;
+  10'd568: q <= 8'd56;
+  10'd569: q <= 8'd57;
+  10'd570: q <= 8'd58;
+  10'd571: q <= 8'd59;
+  10'd572: q <= 8'd60;
+  10'd573: q <= 8'd61;
+  10'd574: q <= 8'd62;
+  10'd575: q <= 8'd63;
+  10'd576: q <= 8'd64;
+  10'd577: q <= 8'd65;
+  10'd578: q <= 8'd66;
+  10'd579: q <= 8'd67;
+  10'd580: q <= 8'd68;
+  10'd581: q <= 8'd69;
+  10'd582: q <= 8'd70;
+  10'd583: q <= 8'd71;
+  10'd584: q <= 8'd72;
+  10'd585: q <= 8'd73;
+  10'd586: q <= 8'd74;
+  10'd587: q <= 8'd75;
+  10'd588: q <= 8'd76;
+  10'd589: q <= 8'd77;
+  10'd590: q <= 8'd78;
+  10'd591: q <= 8'd79;
+  10'd592: q <= 8'd80;
+  10'd593: q <= 8'd81;
+  10'd594: q <= 8'd82;
+  10'd595: q <= 8'd83;
+  10'd596: q <= 8'd84;
+  10'd597: q <= 8'd85;
+  10'd598: q <= 8'd86;
+  10'd599: q <= 8'd87;
+  10'd600: q <= 8'd88;
+  10'd601: q <= 8'd89;
+  10'd602: q <= 8'd90;
+  10'd603: q <= 8'd91;
+  10'd604: q <= 8'd92;
+  10'd605: q <= 8'd93;
+  10'd606: q <= 8'd94;
+  10'd607: q <= 8'd95;
+  10'd608: q <= 8'd96;
+  10'd609: q <= 8'd97;
+  10'd610: q <= 8'd98;
+  10'd611: q <= 8'd99;
+  10'd612: q <= 8'd100;
+  10'd613: q <= 8'd101;
+  10'd614: q <= 8'd102;
+  10'd615: q <= 8'd103;
+  10'd616: q <= 8'd104;
+  10'd617: q <= 8'd105;
+  10'd618: q <= 8'd106;
+  10'd619: q <= 8'd107;
+  10'd620: q <= 8'd108;
+  10'd621: q <= 8'd109;
+  10'd622: q <= 8'd110;
+  10'd623: q <= 8'd111;
+  10'd624: q <= 8'd112;
+  10'd625: q <= 8'd113;
+  10'd626: q <= 8'd114;
+  10'd627: q <= 8'd115;
+  10'd628: q <= 8'd116;
+  10'd629: q <= 8'd117;
+  10'd630: q <= 8'd118;
+  10'd631: q <= 8'd119;
+  10'd632: q <= 8'd120;
+  10'd633: q <= 8'd121;
+  10'd634: q <= 8'd122;
+  10'd635: q <= 8'd123;
+  10'd636: q <= 8'd124;
+  10'd637: q <= 8'd125;
+  10'd638: q <= 8'd126;
+  10'd639: q <= 8'd127;
+  10'd640: q <= 8'd128;
+  10'd641: q <= 8'd129;
+  10'd642: q <= 8'd130;
+  10'd643: q <= 8'd131;
+  10'd644: q <= 8'd132;
+  10'd645: q <= 8'd133;
+  10'd646: q <= 8'd134;
+  10'd647: q <= 8'd135;
+  10'd648: q <= 8'd136;
+  10'd649: q <= 8'd137;
+  10'd650: q <= 8'd138;
+  10'd651: q <= 8'd139;
+  10'd652: q <= 8'd140;
+  10'd653: q <= 8'd141;
+  10'd654: q <= 8'd142;
+  10'd655: q <= 8'd143;
+  10'd656: q <= 8'd144;
+  10'd657: q <= 8'd145;
+  10'd658: q <= 8'd146;
+  10'd659: q <= 8'd147;
+  10'd660: q <= 8'd148;
+  10'd661: q <= 8'd149;
+  10'd662: q <= 8'd150;
+  10'd663: q <= 8'd151;
+  10'd664: q <= 8'd152;
+  10'd665: q <= 8'd153;
+  10'd666: q <= 8'd154;
+  10'd667: q <= 8'd155;
+  10'd668: q <= 8'd156;
+  10'd669: q <= 8'd157;
+  10'd670: q <= 8'd158;
+  10'd671: q <= 8'd159;
+  10'd672: q <= 8'd160;
+  10'd673: q <= 8'd161;
+  10'd674: q <= 8'd162;
+  10'd675: q <= 8'd163;
+  10'd676: q <= 8'd164;
+  10'd677: q <= 8'd165;
+  10'd678: q <= 8'd166;
+  10'd679: q <= 8'd167;
+  10'd680: q <= 8'd168;
+  10'd681: q <= 8'd169;
+  10'd682: q <= 8'd170;
+  10'd683: q <= 8'd171;
+  10'd684: q <= 8'd172;
+  10'd685: q <= 8'd173;
+  10'd686: q <= 8'd174;
+  10'd687: q <= 8'd175;
+  10'd688: q <= 8'd176;
+  10'd689: q <= 8'd177;
+  10'd690: q <= 8'd178;
+  10'd691: q <= 8'd179;
+  10'd692: q <= 8'd180;
+  10'd693: q <= 8'd181;
+  10'd694: q <= 8'd182;
+  10'd695: q <= 8'd183;
+  10'd696: q <= 8'd184;
+  10'd697: q <= 8'd185;
+  10'd698: q <= 8'd186;
+  10'd699: q <= 8'd187;
+  10'd700: q <= 8'd188;
+  10'd701: q <= 8'd189;
+  10'd702: q <= 8'd190;
+  10'd703: q <= 8'd191;
+  10'd704: q <= 8'd192;
+  10'd705: q <= 8'd193;
+  10'd706: q <= 8'd194;
+  10'd707: q <= 8'd195;
+  10'd708: q <= 8'd196;
+  10'd709: q <= 8'd197;
+  10'd710: q <= 8'd198;
+  10'd711: q <= 8'd199;
+  10'd712: q <= 8'd200;
+  10'd713: q <= 8'd201;
+  10'd714: q <= 8'd202;
+  10'd715: q <= 8'd203;
+  10'd716: q <= 8'd204;
+  10'd717: q <= 8'd205;
+  10'd718: q <= 8'd206;
+  10'd719: q <= 8'd207;
+  10'd720: q <= 8'd208;
+  10'd721: q <= 8'd209;
+  10'd722: q <= 8'd210;
+  10'd723: q <= 8'd211;
+  10'd724: q <= 8'd212;
+  10'd725: q <= 8'd213;
+  10'd726: q <= 8'd214;
+  10'd727: q <= 8'd215;
+  10'd728: q <= 8'd216;
+  10'd729: q <= 8'd217;
+  10'd730: q <= 8'd218;
+  10'd731: q <= 8'd219;
+  10'd732: q <= 8'd220;
+  10'd733: q <= 8'd221;
+  10'd734: q <= 8'd222;
+  10'd735: q <= 8'd223;
+  10'd736: q <= 8'd224;
+  10'd737: q <= 8'd225;
+  10'd738: q <= 8'd226;
+  10'd739: q <= 8'd227;
+  10'd740: q <= 8'd228;
+  10'd741: q <= 8'd229;
+  10'd742: q <= 8'd230;
+  10'd743: q <= 8'd231;
+  10'd744: q <= 8'd232;
+  10'd745: q <= 8'd233;
+  10'd746: q <= 8'd234;
+  10'd747: q <= 8'd235;
+  10'd748: q <= 8'd236;
+  10'd749: q <= 8'd237;
+  10'd750: q <= 8'd238;
+  10'd751: q <= 8'd239;
+  10'd752: q <= 8'd240;
+  10'd753: q <= 8'd241;
+  10'd754: q <= 8'd242;
+  10'd755: q <= 8'd243;
+  10'd756: q <= 8'd244;
+  10'd757: q <= 8'd245;
+  10'd758: q <= 8'd246;
+  10'd759: q <= 8'd247;
+  10'd760: q <= 8'd248;
+  10'd761: q <= 8'd249;
+  10'd762: q <= 8'd250;
+  10'd763: q <= 8'd251;
+  10'd764: q <= 8'd252;
+  10'd765: q <= 8'd253;
+  10'd766: q <= 8'd254;
+  10'd767: q <= 8'd255;
+  10'd768: q <= 8'd0;
+  10'd769: q <= 8'd1;
+  10'd770: q <= 8'd2;
+  10'd771: q <= 8'd3;
+  10'd772: q <= 8'd4;
+  10'd773: q <= 8'd5;
+  10'd774: q <= 8'd6;
+  10'd775: q <= 8'd7;
+  10'd776: q <= 8'd8;
+  10'd777: q <= 8'd9;
+  10'd778: q <= 8'd10;
+  10'd779: q <= 8'd11;
+  10'd780: q <= 8'd12;
+  10'd781: q <= 8'd13;
+  10'd782: q <= 8'd14;
+  10'd783: q <= 8'd15;
+  10'd784: q <= 8'd16;
+  10'd785: q <= 8'd17;
+  10'd786: q <= 8'd18;
+  10'd787: q <= 8'd19;
+  10'd788: q <= 8'd20;
+  10'd789: q <= 8'd21;
+  10'd790: q <= 8'd22;
+  10'd791: q <= 8'd23;
+  10'd792: q <= 8'd24;
+  10'd793: q <= 8'd25;
+  10'd794: q <= 8'd26;
+  10'd795: q <= 8'd27;
+  10'd796: q <= 8'd28;
+  10'd797: q <= 8'd29;
+  10'd798: q <= 8'd30;
+  10'd799: q <= 8'd31;
+  10'd800: q <= 8'd32;
+  10'd801: q <= 8'd33;
+  10'd802: q <= 8'd34;
+  10'd803: q <= 8'd35;
+  10'd804: q <= 8'd36;
+  10'd805: q <= 8'd37;
+  10'd806: q <= 8'd38;
+  10'd807: q <= 8'd39;
+  10'd808: q <= 8'd40;
+  10'd809: q <= 8'd41;
+  10'd810: q <= 8'd42;
+  10'd811: q <= 8'd43;
+  10'd812: q <= 8'd44;
+  10'd813: q <= 8'd45;
+  10'd814: q <= 8'd46;
+  10'd815: q <= 8'd47;
+  10'd816: q <= 8'd48;
+  10'd817: q <= 8'd49;
+  10'd818: q <= 8'd50;
+  10'd819: q <= 8'd51;
+  10'd820: q <= 8'd52;
+  10'd821: q <= 8'd53;
+  10'd822: q <= 8'd54;
+  10'd823: q <= 8'd55;
+  10'd824: q <= 8'd56;
+  10'd825: q <= 8'd57;
+  10'd826: q <= 8'd58;
+  10'd827: q <= 8'd59;
+  10'd828: q <= 8'd60;
+  10'd829: q <= 8'd61;
+  10'd830: q <= 8'd62;
+  10'd831: q <= 8'd63;
+  10'd832: q <= 8'd64;
+  10'd833: q <= 8'd65;
+  10'd834: q <= 8'd66;
+  10'd835: q <= 8'd67;
+  10'd836: q <= 8'd68;
+  10'd837: q <= 8'd69;
+  10'd838: q <= 8'd70;
+  10'd839: q <= 8'd71;
+  10'd840: q <= 8'd72;
+  10'd841: q <= 8'd73;
+  10'd842: q <= 8'd74;
+  10'd843: q <= 8'd75;
+  10'd844: q <= 8'd76;
+  10'd845: q <= 8'd77;
+  10'd846: q <= 8'd78;
+  10'd847: q <= 8'd79;
+  10'd848: q <= 8'd80;
+  10'd849: q <= 8'd81;
+  10'd850: q <= 8'd82;
+  10'd851: q <= 8'd83;
+  10'd852: q <= 8'd84;
+  10'd853: q <= 8'd85;
+  10'd854: q <= 8'd86;
+  10'd855: q <= 8'd87;
+  10'd856: q <= 8'd88;
+  10'd857: q <= 8'd89;
+  10'd858: q <= 8'd90;
+  10'd859: q <= 8'd91;
+  10'd860: q <= 8'd92;
+  10'd861: q <= 8'd93;
+  10'd862: q <= 8'd94;
+  10'd863: q <= 8'd95;
+  10'd864: q <= 8'd96;
+  10'd865: q <= 8'd97;
+  10'd866: q <= 8'd98;
+  10'd867: q <= 8'd99;
+  10'd868: q <= 8'd100;
+  10'd869: q <= 8'd101;
+  10'd870: q <= 8'd102;
+  10'd871: q <= 8'd103;
+  10'd872: q <= 8'd104;
+  10'd873: q <= 8'd105;
+  10'd874: q <= 8'd106;
+  10'd875: q <= 8'd107;
+  10'd876: q <= 8'd108;
+  10'd877: q <= 8'd109;
+  10'd878: q <= 8'd110;
+  10'd879: q <= 8'd111;
+  10'd880: q <= 8'd112;
+  10'd881: q <= 8'd113;
+  10'd882: q <= 8'd114;
+  10'd883: q <= 8'd115;
+  10'd884: q <= 8'd116;
+  10'd885: q <= 8'd117;
+  10'd886: q <= 8'd118;
+  10'd887: q <= 8'd119;
+  10'd888: q <= 8'd120;
+  10'd889: q <= 8'd121;
+  10'd890: q <= 8'd122;
+  10'd891: q <= 8'd123;
+  10'd892: q <= 8'd124;
+  10'd893: q <= 8'd125;
+  10'd894: q <= 8'd126;
+  10'd895: q <= 8'd127;
+  10'd896: q <= 8'd128;
+  10'd897: q <= 8'd129;
+  10'd898: q <= 8'd130;
+  10'd899: q <= 8'd131;
+  10'd900: q <= 8'd132;
+  10'd901: q <= 8'd133;
+  10'd902: q <= 8'd134;
+  10'd903: q <= 8'd135;
+  10'd904: q <= 8'd136;
+  10'd905: q <= 8'd137;
+  10'd906: q <= 8'd138;
+  10'd907: q <= 8'd139;
+  10'd908: q <= 8'd140;
+  10'd909: q <= 8'd141;
+  10'd910: q <= 8'd142;
+  10'd911: q <= 8'd143;
+  10'd912: q <= 8'd144;
+  10'd913: q <= 8'd145;
+  10'd914: q <= 8'd146;
+  10'd915: q <= 8'd147;
+  10'd916: q <= 8'd148;
+  10'd917: q <= 8'd149;
+  10'd918: q <= 8'd150;
+  10'd919: q <= 8'd151;
+  10'd920: q <= 8'd152;
+  10'd921: q <= 8'd153;
+  10'd922: q <= 8'd154;
+  10'd923: q <= 8'd155;
+  10'd924: q <= 8'd156;
+  10'd925: q <= 8'd157;
+  10'd926: q <= 8'd158;
+  10'd927: q <= 8'd159;
+  10'd928: q <= 8'd160;
+  10'd929: q <= 8'd161;
+  10'd930: q <= 8'd162;
+  10'd931: q <= 8'd163;
+  10'd932: q <= 8'd164;
+  10'd933: q <= 8'd165;
+  10'd934: q <= 8'd166;
+  10'd935: q <= 8'd167;
+  10'd936: q <= 8'd168;
+  10'd937: q <= 8'd169;
+  10'd938: q <= 8'd170;
+  10'd939: q <= 8'd171;
+  10'd940: q <= 8'd172;
+  10'd941: q <= 8'd173;
+  10'd942: q <= 8'd174;
+  10'd943: q <= 8'd175;
+  10'd944: q <= 8'd176;
+  10'd945: q <= 8'd177;
+  10'd946: q <= 8'd178;
+  10'd947: q <= 8'd179;
+  10'd948: q <= 8'd180;
+  10'd949: q <= 8'd181;
+  10'd950: q <= 8'd182;
+  10'd951: q <= 8'd183;
+  10'd952: q <= 8'd184;
+  10'd953: q <= 8'd185;
+  10'd954: q <= 8'd186;
+  10'd955: q <= 8'd187;
+  10'd956: q <= 8'd188;
+  10'd957: q <= 8'd189;
+  10'd958: q <= 8'd190;
+  10'd959: q <= 8'd191;
+  10'd960: q <= 8'd192;
+  10'd961: q <= 8'd193;
+  10'd962: q <= 8'd194;
+  10'd963: q <= 8'd195;
+  10'd964: q <= 8'd196;
+  10'd965: q <= 8'd197;
+  10'd966: q <= 8'd198;
+  10'd967: q <= 8'd199;
+  10'd968: q <= 8'd200;
+  10'd969: q <= 8'd201;
+  10'd970: q <= 8'd202;
+  10'd971: q <= 8'd203;
+  10'd972: q <= 8'd204;
+  10'd973: q <= 8'd205;
+  10'd974: q <= 8'd206;
+  10'd975: q <= 8'd207;
+  10'd976: q <= 8'd208;
+  10'd977: q <= 8'd209;
+  10'd978: q <= 8'd210;
+  10'd979: q <= 8'd211;
+  10'd980: q <= 8'd212;
+  10'd981: q <= 8'd213;
+  10'd982: q <= 8'd214;
+  10'd983: q <= 8'd215;
+  10'd984: q <= 8'd216;
+  10'd985: q <= 8'd217;
+  10'd986: q <= 8'd218;
+  10'd987: q <= 8'd219;
+  10'd988: q <= 8'd220;
+  10'd989: q <= 8'd221;
+  10'd990: q <= 8'd222;
+  10'd991: q <= 8'd223;
+  10'd992: q <= 8'd224;
+  10'd993: q <= 8'd225;
+  10'd994: q <= 8'd226;
+  10'd995: q <= 8'd227;
+  10'd996: q <= 8'd228;
+  10'd997: q <= 8'd229;
+  10'd998: q <= 8'd230;
+  10'd999: q <= 8'd231;
+ endcase
+end
+always @* begin
+  if (c) y = d;
+end
+endmodule
@@ -0,0 +1,1005 @@
+module l(input a, input b, output reg y);
+always @* begin
+  if (a) y = b;
+end
+  assign w1 = a & b; // padding line 1
+  assign w2 = a & b; // padding line 2
+  assign w3 = a & b; // padding line 3
+  assign w4 = a & b; // padding line 4
+  assign w5 = a & b; // padding line 5
+  assign w6 = a & b; // padding line 6
+  assign w7 = a & b; // padding line 7
+  assign w8 = a & b; // padding line 8
+  assign w9 = a & b; // padding line 9
+  assign w10 = a & b; // padding line 10
+  assign w11 = a & b; // padding line 11
+  assign w12 = a & b; // padding line 12
+  assign w13 = a & b; // padding line 13
+  assign w14 = a & b; // padding line 14
+  assign w15 = a & b; // padding line 15
+  assign w16 = a & b; // padding line 16
+  assign w17 = a & b; // padding line 17
+  assign w18 = a & b; // padding line 18
+  assign w19 = a & b; // padding line 19
+  assign w20 = a & b; // padding line 20
+  assign w21 = a & b; // padding line 21
+  assign w22 = a & b; // padding line 22
+  assign w23 = a & b; // padding line 23
+  assign w24 = a & b; // padding line 24
+  assign w25 = a & b; // padding line 25
+  assign w26 = a & b; // padding line 26
+  assign w27 = a & b; // padding line 27
+  assign w28 = a & b; // padding line 28
+  assign w29 = a & b; // padding line 29
+  assign w30 = a & b; // padding line 30
+  assign w31 = a & b; // padding line 31
+  assign w32 = a & b; // padding line 32
+  assign w33 = a & b; // padding line 33
+  assign w34 = a & b; // padding line 34
+  assign w35 = a & b; // padding line 35
+  assign w36 = a & b; // padding line 36
+  assign w37 = a & b; // padding line 37
+  assign w38 = a & b; // padding line 38
+  assign w39 = a & b; // padding line 39
+  assign w40 = a & b; // padding line 40
+  assign w41 = a & b; // padding line 41
+  assign w42 = a & b; // padding line 42
+  assign w43 = a & b; // padding line 43
+  assign w44 = a & b; // padding line 44
+  assign w45 = a & b; // padding line 45
+  assign w46 = a & b; // padding line 46
+  assign w47 = a & b; // padding line 47
+  assign w48 = a & b; // padding line 48
+  assign w49 = a & b; // padding line 49
+  assign w50 = a & b; // padding line 50
+  assign w51 = a & b; // padding line 51
+  assign w52 = a & b; // padding line 52
+  assign w53 = a & b; // padding line 53
+  assign w54 = a & b; // padding line 54
+  assign w55 = a & b; // padding line 55
+  assign w56 = a & b; // padding line 56
+  assign w57 = a & b; // padding line 57
+  assign w58 = a & b; // padding line 58
+  assign w59 = a & b; // padding line 59
+  assign w60 = a & b; // padding line 60
+  assign w61 = a & b; // padding line 61
+  assign w62 = a & b; // padding line 62
+  assign w63 = a & b; // padding line 63
+  assign w64 = a & b; // padding line 64
+  assign w65 = a & b; // padding line 65
+  assign w66 = a & b; // padding line 66
+  assign w67 = a & b; // padding line 67
+  assign w68 = a & b; // padding line 68
+  assign w69 = a & b; // padding line 69
+  assign w70 = a & b; // padding line 70
+  assign w71 = a & b; // padding line 71
+  assign w72 = a & b; // padding line 72
+  assign w73 = a & b; // padding line 73
+  assign w74 = a & b; // padding line 74
+  assign w75 = a & b; // padding line 75
+  assign w76 = a & b; // padding line 76
+  assign w77 = a & b; // padding line 77
+  assign w78 = a & b; // padding line 78
+  assign w79 = a & b; // padding line 79
+  assign w80 = a & b; // padding line 80
+  assign w81 = a & b; // padding line 81
+  assign w82 = a & b; // padding line 82
+  assign w83 = a & b; // padding line 83
+  assign w84 = a & b; // padding line 84
+  assign w85 = a & b; // padding line 85
+  assign w86 = a & b; // padding line 86
+  assign w87 = a & b; // padding line 87
+  assign w88 = a & b; // padding line 88
+  assign w89 = a & b; // padding line 89
+  assign w90 = a & b; // padding line 90
+  assign w91 = a & b; // padding line 91
+  assign w92 = a & b; // padding line 92
+  assign w93 = a & b; // padding line 93
+  assign w94 = a & b; // padding line 94
+  assign w95 = a & b; // padding line 95
+  assign w96 = a & b; // padding line 96
+  assign w97 = a & b; // padding line 97
+  assign w98 = a & b; // padding line 98
+  assign w99 = a & b; // padding line 99
+  assign w100 = a & b; // padding line 100
+  assign w101 = a & b; // padding line 101
+  assign w102 = a & b; // padding line 102
+  assign w103 = a & b; // padding line 103
+  assign w104 = a & b; // padding line 104
+  assign w105 = a & b; // padding line 105
+  assign w106 = a & b; // padding line 106
+  assign w107 = a & b; // padding line 107
+  assign w108 = a & b; // padding line 108
+  assign w109 = a & b; // padding line 109
+  assign w110 = a & b; // padding line 110
+  assign w111 = a & b; // padding line 111
+  assign w112 = a & b; // padding line 112
+  assign w113 = a & b; // padding line 113
+  assign w114 = a & b; // padding line 114
+  assign w115 = a & b; // padding line 115
+  assign w116 = a & b; // padding line 116
+  assign w117 = a & b; // padding line 117
+  assign w118 = a & b; // padding line 118
+  assign w119 = a & b; // padding line 119
+  assign w120 = a & b; // padding line 120
+  assign w121 = a & b; // padding line 121
+  assign w122 = a & b; // padding line 122
+  assign w123 = a & b; // padding line 123
+  assign w124 = a & b; // padding line 124
+  assign w125 = a & b; // padding line 125
+  assign w126 = a & b; // padding line 126
+  assign w127 = a & b; // padding line 127
+  assign w128 = a & b; // padding line 128
+  assign w129 = a & b; // padding line 129
+  assign w130 = a & b; // padding line 130
+  assign w131 = a & b; // padding line 131
+  assign w132 = a & b; // padding line 132
+  assign w133 = a & b; // padding line 133
+  assign w134 = a & b; // padding line 134
+  assign w135 = a & b; // padding line 135
+  assign w136 = a & b; // padding line 136
+  assign w137 = a & b; // padding line 137
+  assign w138 = a & b; // padding line 138
+  assign w139 = a & b; // padding line 139
+  assign w140 = a & b; // padding line 140
+  assign w141 = a & b; // padding line 141
+  assign w142 = a & b; // padding line 142
+  assign w143 = a & b; // padding line 143
+  assign w144 = a & b; // padding line 144
+  assign w145 = a & b; // padding line 145
+  assign w146 = a & b; // padding line 146
+  assign w147 = a & b; // padding line 147
+  assign w148 = a & b; // padding line 148
+  assign w149 = a & b; // padding line 149
+  assign w150 = a & b; // padding line 150
+  assign w151 = a & b; // padding line 151
+  assign w152 = a & b; // padding line 152
+  assign w153 = a & b; // padding line 153
+  assign w154 = a & b; // padding line 154
+  assign w155 = a & b; // padding line 155
+  assign w156 = a & b; // padding line 156
+  assign w157 = a & b; // padding line 157
+  assign w158 = a & b; // padding line 158
+  assign w159 = a & b; // padding line 159
+  assign w160 = a & b; // padding line 160
+  assign w161 = a & b; // padding line 161
+  assign w162 = a & b; // padding line 162
+  assign w163 = a & b; // padding line 163
+  assign w164 = a & b; // padding line 164
+  assign w165 = a & b; // padding line 165
+  assign w166 = a & b; // padding line 166
+  assign w167 = a & b; // padding line 167
+  assign w168 = a & b; // padding line 168
+  assign w169 = a & b; // padding line 169
+  assign w170 = a & b; // padding line 170
+  assign w171 = a & b; // padding line 171
+  assign w172 = a & b; // padding line 172
+  assign w173 = a & b; // padding line 173
+  assign w174 = a & b; // padding line 174
+  assign w175 = a & b; // padding line 175
+  assign w176 = a & b; // padding line 176
+  assign w177 = a & b; // padding line 177
+  assign w178 = a & b; // padding line 178
+  assign w179 = a & b; // padding line 179
+  assign w180 = a & b; // padding line 180
+  assign w181 = a & b; // padding line 181
+  assign w182 = a & b; // padding line 182
+  assign w183 = a & b; // padding line 183
+  assign w184 = a & b; // padding line 184
+  assign w185 = a & b; // padding line 185
+  assign w186 = a & b; // padding line 186
+  assign w187 = a & b; // padding line 187
+  assign w188 = a & b; // padding line 188
+  assign w189 = a & b; // padding line 189
+  assign w190 = a & b; // padding line 190
+  assign w191 = a & b; // padding line 191
+  assign w192 = a & b; // padding line 192
+  assign w193 = a & b; // padding line 193
+  assign w194 = a & b; // padding line 194
+  assign w195 = a & b; // padding line 195
+  assign w196 = a & b; // padding line 196
+  assign w197 = a & b; // padding line 197
+  assign w198 = a & b; // padding line 198
+  assign w199 = a & b; // padding line 199
+  assign w200 = a & b; // padding line 200
+  assign w201 = a & b; // padding line 201
+  assign w202 = a & b; // padding line 202
+  assign w203 = a & b; // padding line 203
+  assign w204 = a & b; // padding line 204
+  assign w205 = a & b; // padding line 205
+  assign w206 = a & b; // padding line 206
+  assign w207 = a & b; // padding line 207
+  assign w208 = a & b; // padding line 208
+  assign w209 = a & b; // padding line 209
+  assign w210 = a & b; // padding line 210
+  assign w211 = a & b; // padding line 211
+  assign w212 = a & b; // padding line 212
+  assign w213 = a & b; // padding line 213
+  assign w214 = a & b; // padding line 214
+  assign w215 = a & b; // padding line 215
+  assign w216 = a & b; // padding line 216
+  assign w217 = a & b; // padding line 217
+  assign w218 = a & b; // padding line 218
+  assign w219 = a & b; // padding line 219
+  assign w220 = a & b; // padding line 220
+  assign w221 = a & b; // padding line 221
+  assign w222 = a & b; // padding line 222
+  assign w223 = a & b; // padding line 223
+  assign w224 = a & b; // padding line 224
+  assign w225 = a & b; // padding line 225
+  assign w226 = a & b; // padding line 226
+  assign w227 = a & b; // padding line 227
+  assign w228 = a & b; // padding line 228
+  assign w229 = a & b; // padding line 229
+  assign w230 = a & b; // padding line 230
+  assign w231 = a & b; // padding line 231
+  assign w232 = a & b; // padding line 232
+  assign w233 = a & b; // padding line 233
+  assign w234 = a & b; // padding line 234
+  assign w235 = a & b; // padding line 235
+  assign w236 = a & b; // padding line 236
+  assign w237 = a & b; // padding line 237
+  assign w238 = a & b; // padding line 238
+  assign w239 = a & b; // padding line 239
+  assign w240 = a & b; // padding line 240
+  assign w241 = a & b; // padding line 241
+  assign w242 = a & b; // padding line 242
+  assign w243 = a & b; // padding line 243
+  assign w244 = a & b; // padding line 244
+  assign w245 = a & b; // padding line 245
+  assign w246 = a & b; // padding line 246
+  assign w247 = a & b; // padding line 247
+  assign w248 = a & b; // padding line 248
+  assign w249 = a & b; // padding line 249
+  assign w250 = a & b; // padding line 250
+  assign w251 = a & b; // padding line 251
+  assign w252 = a & b; // padding line 252
+  assign w253 = a & b; // padding line 253
+  assign w254 = a & b; // padding line 254
+  assign w255 = a & b; // padding line 255
+  assign w256 = a & b; // padding line 256
+  assign w257 = a & b; // padding line 257
+  assign w258 = a & b; // padding line 258
+  assign w259 = a & b; // padding line 259
+  assign w260 = a & b; // padding line 260
+  assign w261 = a & b; // padding line 261
+  assign w262 = a & b; // padding line 262
+  assign w263 = a & b; // padding line 263
+  assign w264 = a & b; // padding line 264
+  assign w265 = a & b; // padding line 265
+  assign w266 = a & b; // padding line 266
+  assign w267 = a & b; // padding line 267
+  assign w268 = a & b; // padding line 268
+  assign w269 = a & b; // padding line 269
+  assign w270 = a & b; // padding line 270
+  assign w271 = a & b; // padding line 271
+  assign w272 = a & b; // padding line 272
+  assign w273 = a & b; // padding line 273
+  assign w274 = a & b; // padding line 274
+  assign w275 = a & b; // padding line 275
+  assign w276 = a & b; // padding line 276
+  assign w277 = a & b; // padding line 277
+  assign w278 = a & b; // padding line 278
+  assign w279 = a & b; // padding line 279
+  assign w280 = a & b; // padding line 280
+  assign w281 = a & b; // padding line 281
+  assign w282 = a & b; // padding line 282
+  assign w283 = a & b; // padding line 283
+  assign w284 = a & b; // padding line 284
+  assign w285 = a & b; // padding line 285
+  assign w286 = a & b; // padding line 286
+  assign w287 = a & b; // padding line 287
+  assign w288 = a & b; // padding line 288
+  assign w289 = a & b; // padding line 289
+  assign w290 = a & b; // padding line 290
+  assign w291 = a & b; // padding line 291
+  assign w292 = a & b; // padding line 292
+  assign w293 = a & b; // padding line 293
+  assign w294 = a & b; // padding line 294
+  assign w295 = a & b; // padding line 295
+  assign w296 = a & b; // padding line 296
+  assign w297 = a & b; // padding line 297
+  assign w298 = a & b; // padding line 298
+  assign w299 = a & b; // padding line 299
+  assign w300 = a & b; // padding line 300
+  assign w301 = a & b; // padding line 301
+  assign w302 = a & b; // padding line 302
+  assign w303 = a & b; // padding line 303
+  assign w304 = a & b; // padding line 304
+  assign w305 = a & b; // padding line 305
+  assign w306 = a & b; // padding line 306
+  assign w307 = a & b; // padding line 307
+  assign w308 = a & b; // padding line 308
+  assign w309 = a & b; // padding line 309
+  assign w310 = a & b; // padding line 310
+  assign w311 = a & b; // padding line 311
+  assign w312 = a & b; // padding line 312
+  assign w313 = a & b; // padding line 313
+  assign w314 = a & b; // padding line 314
+  assign w315 = a & b; // padding line 315
+  assign w316 = a & b; // padding line 316
+  assign w317 = a & b; // padding line 317
+  assign w318 = a & b; // padding line 318
+  assign w319 = a & b; // padding line 319
+  assign w320 = a & b; // padding line 320
+  assign w321 = a & b; // padding line 321
+  assign w322 = a & b; // padding line 322
+  assign w323 = a & b; // padding line 323
+  assign w324 = a & b; // padding line 324
+  assign w325 = a & b; // padding line 325
+  assign w326 = a & b; // padding line 326
+  assign w327 = a & b; // padding line 327
+  assign w328 = a & b; // padding line 328
+  assign w329 = a & b; // padding line 329
+  assign w330 = a & b; // padding line 330
+  assign w331 = a & b; // padding line 331
+  assign w332 = a & b; // padding line 332
+  assign w333 = a & b; // padding line 333
+  assign w334 = a & b; // padding line 334
+  assign w335 = a & b; // padding line 335
+  assign w336 = a & b; // padding line 336
+  assign w337 = a & b; // padding line 337
+  assign w338 = a & b; // padding line 338
+  assign w339 = a & b; // padding line 339
+  assign w340 = a & b; // padding line 340
+  assign w341 = a & b; // padding line 341
+  assign w342 = a & b; // padding line 342
+  assign w343 = a & b; // padding line 343
+  assign w344 = a & b; // padding line 344
+  assign w345 = a & b; // padding line 345
+  assign w346 = a & b; // padding line 346
+  assign w347 = a & b; // padding line 347
+  assign w348 = a & b; // padding line 348
+  assign w349 = a & b; // padding line 349
+  assign w350 = a & b; // padding line 350
+  assign w351 = a & b; // padding line 351
+  assign w352 = a & b; // padding line 352
+  assign w353 = a & b; // padding line 353
+  assign w354 = a & b; // padding line 354
+  assign w355 = a & b; // padding line 355
+  assign w356 = a & b; // padding line 356
+  assign w357 = a & b; // padding line 357
+  assign w358 = a & b; // padding line 358
+  assign w359 = a & b; // padding line 359
+  assign w360 = a & b; // padding line 360
+  assign w361 = a & b; // padding line 361
+  assign w362 = a & b; // padding line 362
+  assign w363 = a & b; // padding line 363
+  assign w364 = a & b; // padding line 364
+  assign w365 = a & b; // padding line 365
+  assign w366 = a & b; // padding line 366
+  assign w367 = a & b; // padding line 367
+  assign w368 = a & b; // padding line 368
+  assign w369 = a & b; // padding line 369
+  assign w370 = a & b; // padding line 370
+  assign w371 = a & b; // padding line 371
+  assign w372 = a & b; // padding line 372
+  assign w373 = a & b; // padding line 373
+  assign w374 = a & b; // padding line 374
+  assign w375 = a & b; // padding line 375
+  assign w376 = a & b; // padding line 376
+  assign w377 = a & b; // padding line 377
+  assign w378 = a & b; // padding line 378
+  assign w379 = a & b; // padding line 379
+  assign w380 = a & b; // padding line 380
+  assign w381 = a & b; // padding line 381
+  assign w382 = a & b; // padding line 382
+  assign w383 = a & b; // padding line 383
+  assign w384 = a & b; // padding line 384
+  assign w385 = a & b; // padding line 385
+  assign w386 = a & b; // padding line 386
+  assign w387 = a & b; // padding line 387
+  assign w388 = a & b; // padding line 388
+  assign w389 = a & b; // padding line 389
+  assign w390 = a & b; // padding line 390
+  assign w391 = a & b; // padding line 391
+  assign w392 = a & b; // padding line 392
+  assign w393 = a & b; // padding line 393
+  assign w394 = a & b; // padding line 394
+  assign w395 = a & b; // padding line 395
+  assign w396 = a & b; // padding line 396
+  assign w397 = a & b; // padding line 397
+  assign w398 = a & b; // padding line 398
+  assign w399 = a & b; // padding line 399
+  assign w400 = a & b; // padding line 400
+  assign w401 = a & b; // padding line 401
+  assign w402 = a & b; // padding line 402
+  assign w403 = a & b; // padding line 403
+  assign w404 = a & b; // padding line 404
+  assign w405 = a & b; // padding line 405
+  assign w406 = a & b; // padding line 406
+  assign w407 = a & b; // padding line 407
+  assign w408 = a & b; // padding line 408
+  assign w409 = a & b; // padding line 409
+  assign w410 = a & b; // padding line 410
+  assign w411 = a & b; // padding line 411
+  assign w412 = a & b; // padding line 412
+  assign w413 = a & b; // padding line 413
+  assign w414 = a & b; // padding line 414
+  assign w415 = a & b; // padding line 415
+  assign w416 = a & b; // padding line 416
+  assign w417 = a & b; // padding line 417
+  assign w418 = a & b; // padding line 418
+  assign w419 = a & b; // padding line 419
+  assign w420 = a & b; // padding line 420
+  assign w421 = a & b; // padding line 421
+  assign w422 = a & b; // padding line 422
+  assign w423 = a & b; // padding line 423
+  assign w424 = a & b; // padding line 424
+  assign w425 = a & b; // padding line 425
+  assign w426 = a & b; // padding line 426
+  assign w427 = a & b; // padding line 427
+  assign w428 = a & b; // padding line 428
+  assign w429 = a & b; // padding line 429
+  assign w430 = a & b; // padding line 430
+  assign w431 = a & b; // padding line 431
+  assign w432 = a & b; // padding line 432
+  assign w433 = a & b; // padding line 433
+  assign w434 = a & b; // padding line 434
+  assign w435 = a & b; // padding line 435
+  assign w436 = a & b; // padding line 436
+  assign w437 = a & b; // padding line 437
+  assign w438 = a & b; // padding line 438
+  assign w439 = a & b; // padding line 439
+  assign w440 = a & b; // padding line 440
+  assign w441 = a & b; // padding line 441
+  assign w442 = a & b; // padding line 442
+  assign w443 = a & b; // padding line 443
+  assign w444 = a & b; // padding line 444
+  assign w445 = a & b; // padding line 445
+  assign w446 = a & b; // padding line 446
+  assign w447 = a & b; // padding line 447
+  assign w448 = a & b; // padding line 448
+  assign w449 = a & b; // padding line 449
+  assign w450 = a & b; // padding line 450
+  assign w451 = a & b; // padding line 451
+  assign w452 = a & b; // padding line 452
+  assign w453 = a & b; // padding line 453
+  assign w454 = a & b; // padding line 454
+  assign w455 = a & b; // padding line 455
+  assign w456 = a & b; // padding line 456
+  assign w457 = a & b; // padding line 457
+  assign w458 = a & b; // padding line 458
+  assign w459 = a & b; // padding line 459
+  assign w460 = a & b; // padding line 460
+  assign w461 = a & b; // padding line 461
+  assign w462 = a & b; // padding line 462
+  assign w463 = a & b; // padding line 463
+  assign w464 = a & b; // padding line 464
+  assign w465 = a & b; // padding line 465
+  assign w466 = a & b; // padding line 466
+  assign w467 = a & b; // padding line 467
+  assign w468 = a & b; // padding line 468
+  assign w469 = a & b; // padding line 469
+  assign w470 = a & b; // padding line 470
+  assign w471 = a & b; // padding line 471
+  assign w472 = a & b; // padding line 472
+  assign w473 = a & b; // padding line 473
+  assign w474 = a & b; // padding line 474
+  assign w475 = a & b; // padding line 475
+  assign w476 = a & b; // padding line 476
+  assign w477 = a & b; // padding line 477
+  assign w478 = a & b; // padding line 478
+  assign w479 = a & b; // padding line 479
+  assign w480 = a & b; // padding line 480
+  assign w481 = a & b; // padding line 481
+  assign w482 = a & b; // padding line 482
+  assign w483 = a & b; // padding line 483
+  assign w484 = a & b; // padding line 484
+  assign w485 = a & b; // padding line 485
+  assign w486 = a & b; // padding line 486
+  assign w487 = a & b; // padding line 487
+  assign w488 = a & b; // padding line 488
+  assign w489 = a & b; // padding line 489
+  assign w490 = a & b; // padding line 490
+  assign w491 = a & b; // padding line 491
+  assign w492 = a & b; // padding line 492
+  assign w493 = a & b; // padding line 493
+  assign w494 = a & b; // padding line 494
+  assign w495 = a & b; // padding line 495
+  assign w496 = a & b; // padding line 496
+  assign w497 = a & b; // padding line 497
+  assign w498 = a & b; // padding line 498
+  assign w499 = a & b; // padding line 499
+  assign w500 = a & b; // padding line 500
+  assign w501 = a & b; // padding line 501
+  assign w502 = a & b; // padding line 502
+  assign w503 = a & b; // padding line 503
+  assign w504 = a & b; // padding line 504
+  assign w505 = a & b; // padding line 505
+  assign w506 = a & b; // padding line 506
+  assign w507 = a & b; // padding line 507
+  assign w508 = a & b; // padding line 508
+  assign w509 = a & b; // padding line 509
+  assign w510 = a & b; // padding line 510
+  assign w511 = a & b; // padding line 511
+  assign w512 = a & b; // padding line 512
+  assign w513 = a & b; // padding line 513
+  assign w514 = a & b; // padding line 514
+  assign w515 = a & b; // padding line 515
+  assign w516 = a & b; // padding line 516
+  assign w517 = a & b; // padding line 517
+  assign w518 = a & b; // padding line 518
+  assign w519 = a & b; // padding line 519
+  assign w520 = a & b; // padding line 520
+  assign w521 = a & b; // padding line 521
+  assign w522 = a & b; // padding line 522
+  assign w523 = a & b; // padding line 523
+  assign w524 = a & b; // padding line 524
+  assign w525 = a & b; // padding line 525
+  assign w526 = a & b; // padding line 526
+  assign w527 = a & b; // padding line 527
+  assign w528 = a & b; // padding line 528
+  assign w529 = a & b; // padding line 529
+  assign w530 = a & b; // padding line 530
+  assign w531 = a & b; // padding line 531
+  assign w532 = a & b; // padding line 532
+  assign w533 = a & b; // padding line 533
+  assign w534 = a & b; // padding line 534
+  assign w535 = a & b; // padding line 535
+  assign w536 = a & b; // padding line 536
+  assign w537 = a & b; // padding line 537
+  assign w538 = a & b; // padding line 538
+  assign w539 = a & b; // padding line 539
+  assign w540 = a & b; // padding line 540
+  assign w541 = a & b; // padding line 541
+  assign w542 = a & b; // padding line 542
+  assign w543 = a & b; // padding line 543
+  assign w544 = a & b; // padding line 544
+  assign w545 = a & b; // padding line 545
+  assign w546 = a & b; // padding line 546
+  assign w547 = a & b; // padding line 547
+  assign w548 = a & b; // padding line 548
+  assign w549 = a & b; // padding line 549
+  assign w550 = a & b; // padding line 550
+  assign w551 = a & b; // padding line 551
+  assign w552 = a & b; // padding line 552
+  assign w553 = a & b; // padding line 553
+  assign w554 = a & b; // padding line 554
+  assign w555 = a & b; // padding line 555
+  assign w556 = a & b; // padding line 556
+  assign w557 = a & b; // padding line 557
+  assign w558 = a & b; // padding line 558
+  assign w559 = a & b; // padding line 559
+  assign w560 = a & b; // padding line 560
+  assign w561 = a & b; // padding line 561
+  assign w562 = a & b; // padding line 562
+  assign w563 = a & b; // padding line 563
+  assign w564 = a & b; // padding line 564
+  assign w565 = a & b; // padding line 565
+  assign w566 = a & b; // padding line 566
+  assign w567 = a & b; // padding line 567
+  assign w568 = a & b; // padding line 568
+  assign w569 = a & b; // padding line 569
+  assign w570 = a & b; // padding line 570
+  assign w571 = a & b; // padding line 571
+  assign w572 = a & b; // padding line 572
+  assign w573 = a & b; // padding line 573
+  assign w574 = a & b; // padding line 574
+  assign w575 = a & b; // padding line 575
+  assign w576 = a & b; // padding line 576
+  assign w577 = a & b; // padding line 577
+  assign w578 = a & b; // padding line 578
+  assign w579 = a & b; // padding line 579
+  assign w580 = a & b; // padding line 580
+  assign w581 = a & b; // padding line 581
+  assign w582 = a & b; // padding line 582
+  assign w583 = a & b; // padding line 583
+  assign w584 = a & b; // padding line 584
+  assign w585 = a & b; // padding line 585
+  assign w586 = a & b; // padding line 586
+  assign w587 = a & b; // padding line 587
+  assign w588 = a & b; // padding line 588
+  assign w589 = a & b; // padding line 589
+  assign w590 = a & b; // padding line 590
+  assign w591 = a & b; // padding line 591
+  assign w592 = a & b; // padding line 592
+  assign w593 = a & b; // padding line 593
+  assign w594 = a & b; // padding line 594
+  assign w595 = a & b; // padding line 595
+  assign w596 = a & b; // padding line 596
+  assign w597 = a & b; // padding line 597
+  assign w598 = a & b; // padding line 598
+  assign w599 = a & b; // padding line 599
+  assign w600 = a & b; // padding line 600
+  assign w601 = a & b; // padding line 601
+  assign w602 = a & b; // padding line 602
+  assign w603 = a & b; // padding line 603
+  assign w604 = a & b; // padding line 604
+  assign w605 = a & b; // padding line 605
+  assign w606 = a & b; // padding line 606
+  assign w607 = a & b; // padding line 607
+  assign w608 = a & b; // padding line 608
+  assign w609 = a & b; // padding line 609
+  assign w610 = a & b; // padding line 610
+  assign w611 = a & b; // padding line 611
+  assign w612 = a & b; // padding line 612
+  assign w613 = a & b; // padding line 613
+  assign w614 = a & b; // padding line 614
+  assign w615 = a & b; // padding line 615
+  assign w616 = a & b; // padding line 616
+  assign w617 = a & b; // padding line 617
+  assign w618 = a & b; // padding line 618
+  assign w619 = a & b; // padding line 619
+  assign w620 = a & b; // padding line 620
+  assign w621 = a & b; // padding line 621
+  assign w622 = a & b; // padding line 622
+  assign w623 = a & b; // padding line 623
+  assign w624 = a & b; // padding line 624
+  assign w625 = a & b; // padding line 625
+  assign w626 = a & b; // padding line 626
+  assign w627 = a & b; // padding line 627
+  assign w628 = a & b; // padding line 628
+  assign w629 = a & b; // padding line 629
+  assign w630 = a & b; // padding line 630
+  assign w631 = a & b; // padding line 631
+  assign w632 = a & b; // padding line 632
+  assign w633 = a & b; // padding line 633
+  assign w634 = a & b; // padding line 634
+  assign w635 = a & b; // padding line 635
+  assign w636 = a & b; // padding line 636
+  assign w637 = a & b; // padding line 637
+  assign w638 = a & b; // padding line 638
+  assign w639 = a & b; // padding line 639
+  assign w640 = a & b; // padding line 640
+  assign w641 = a & b; // padding line 641
+  assign w642 = a & b; // padding line 642
+  assign w643 = a & b; // padding line 643
+  assign w644 = a & b; // padding line 644
+  assign w645 = a & b; // padding line 645
+  assign w646 = a & b; // padding line 646
+  assign w647 = a & b; // padding line 647
+  assign w648 = a & b; // padding line 648
+  assign w649 = a & b; // padding line 649
+  assign w650 = a & b; // padding line 650
+  assign w651 = a & b; // padding line 651
+  assign w652 = a & b; // padding line 652
+  assign w653 = a & b; // padding line 653
+  assign w654 = a & b; // padding line 654
+  assign w655 = a & b; // padding line 655
+  assign w656 = a & b; // padding line 656
+  assign w657 = a & b; // padding line 657
+  assign w658 = a & b; // padding line 658
+  assign w659 = a & b; // padding line 659
+  assign w660 = a & b; // padding line 660
+  assign w661 = a & b; // padding line 661
+  assign w662 = a & b; // padding line 662
+  assign w663 = a & b; // padding line 663
+  assign w664 = a & b; // padding line 664
+  assign w665 = a & b; // padding line 665
+  assign w666 = a & b; // padding line 666
+  assign w667 = a & b; // padding line 667
+  assign w668 = a & b; // padding line 668
+  assign w669 = a & b; // padding line 669
+  assign w670 = a & b; // padding line 670
+  assign w671 = a & b; // padding line 671
+  assign w672 = a & b; // padding line 672
+  assign w673 = a & b; // padding line 673
+  assign w674 = a & b; // padding line 674
+  assign w675 = a & b; // padding line 675
+  assign w676 = a & b; // padding line 676
+  assign w677 = a & b; // padding line 677
+  assign w678 = a & b; // padding line 678
+  assign w679 = a & b; // padding line 679
+  assign w680 = a & b; // padding line 680
+  assign w681 = a & b; // padding line 681
+  assign w682 = a & b; // padding line 682
+  assign w683 = a & b; // padding line 683
+  assign w684 = a & b; // padding line 684
+  assign w685 = a & b; // padding line 685
+  assign w686 = a & b; // padding line 686
+  assign w687 = a & b; // padding line 687
+  assign w688 = a & b; // padding line 688
+  assign w689 = a & b; // padding line 689
+  assign w690 = a & b; // padding line 690
+  assign w691 = a & b; // padding line 691
+  assign w692 = a & b; // padding line 692
+  assign w693 = a & b; // padding line 693
+  assign w694 = a & b; // padding line 694
+  assign w695 = a & b; // padding line 695
+  assign w696 = a & b; // padding line 696
+  assign w697 = a & b; // padding line 697
+  assign w698 = a & b; // padding line 698
+  assign w699 = a & b; // padding line 699
+  assign w700 = a & b; // padding line 700
+  assign w701 = a & b; // padding line 701
+  assign w702 = a & b; // padding line 702
+  assign w703 = a & b; // padding line 703
+  assign w704 = a & b; // padding line 704
+  assign w705 = a & b; // padding line 705
+  assign w706 = a & b; // padding line 706
+  assign w707 = a & b; // padding line 707
+  assign w708 = a & b; // padding line 708
+  assign w709 = a & b; // padding line 709
+  assign w710 = a & b; // padding line 710
+  assign w711 = a & b; // padding line 711
+  assign w712 = a & b; // padding line 712
+  assign w713 = a & b; // padding line 713
+  assign w714 = a & b; // padding line 714
+  assign w715 = a & b; // padding line 715
+  assign w716 = a & b; // padding line 716
+  assign w717 = a & b; // padding line 717
+  assign w718 = a & b; // padding line 718
+  assign w719 = a & b; // padding line 719
+  assign w720 = a & b; // padding line 720
+  assign w721 = a & b; // padding line 721
+  assign w722 = a & b; // padding line 722
+  assign w723 = a & b; // padding line 723
+  assign w724 = a & b; // padding line 724
+  assign w725 = a & b; // padding line 725
+  assign w726 = a & b; // padding line 726
+  assign w727 = a & b; // padding line 727
+  assign w728 = a & b; // padding line 728
+  assign w729 = a & b; // padding line 729
+  assign w730 = a & b; // padding line 730
+  assign w731 = a & b; // padding line 731
+  assign w732 = a & b; // padding line 732
+  assign w733 = a & b; // padding line 733
+  assign w734 = a & b; // padding line 734
+  assign w735 = a & b; // padding line 735
+  assign w736 = a & b; // padding line 736
+  assign w737 = a & b; // padding line 737
+  assign w738 = a & b; // padding line 738
+  assign w739 = a & b; // padding line 739
+  assign w740 = a & b; // padding line 740
+  assign w741 = a & b; // padding line 741
+  assign w742 = a & b; // padding line 742
+  assign w743 = a & b; // padding line 743
+  assign w744 = a & b; // padding line 744
+  assign w745 = a & b; // padding line 745
+  assign w746 = a & b; // padding line 746
+  assign w747 = a & b; // padding line 747
+  assign w748 = a & b; // padding line 748
+  assign w749 = a & b; // padding line 749
+  assign w750 = a & b; // padding line 750
+  assign w751 = a & b; // padding line 751
+  assign w752 = a & b; // padding line 752
+  assign w753 = a & b; // padding line 753
+  assign w754 = a & b; // padding line 754
+  assign w755 = a & b; // padding line 755
+  assign w756 = a & b; // padding line 756
+  assign w757 = a & b; // padding line 757
+  assign w758 = a & b; // padding line 758
+  assign w759 = a & b; // padding line 759
+  assign w760 = a & b; // padding line 760
+  assign w761 = a & b; // padding line 761
+  assign w762 = a & b; // padding line 762
+  assign w763 = a & b; // padding line 763
+  assign w764 = a & b; // padding line 764
+  assign w765 = a & b; // padding line 765
+  assign w766 = a & b; // padding line 766
+  assign w767 = a & b; // padding line 767
+  assign w768 = a & b; // padding line 768
+  assign w769 = a & b; // padding line 769
+  assign w770 = a & b; // padding line 770
+  assign w771 = a & b; // padding line 771
+  assign w772 = a & b; // padding line 772
+  assign w773 = a & b; // padding line 773
+  assign w774 = a & b; // padding line 774
+  assign w775 = a & b; // padding line 775
+  assign w776 = a & b; // padding line 776
+  assign w777 = a & b; // padding line 777
+  assign w778 = a & b; // padding line 778
+  assign w779 = a & b; // padding line 779
+  assign w780 = a & b; // padding line 780
+  assign w781 = a & b; // padding line 781
+  assign w782 = a & b; // padding line 782
+  assign w783 = a & b; // padding line 783
+  assign w784 = a & b; // padding line 784
+  assign w785 = a & b; // padding line 785
+  assign w786 = a & b; // padding line 786
+  assign w787 = a & b; // padding line 787
+  assign w788 = a & b; // padding line 788
+  assign w789 = a & b; // padding line 789
+  assign w790 = a & b; // padding line 790
+  assign w791 = a & b; // padding line 791
+  assign w792 = a & b; // padding line 792
+  assign w793 = a & b; // padding line 793
+  assign w794 = a & b; // padding line 794
+  assign w795 = a & b; // padding line 795
+  assign w796 = a & b; // padding line 796
+  assign w797 = a & b; // padding line 797
+  assign w798 = a & b; // padding line 798
+  assign w799 = a & b; // padding line 799
+  assign w800 = a & b; // padding line 800
+  assign w801 = a & b; // padding line 801
+  assign w802 = a & b; // padding line 802
+  assign w803 = a & b; // padding line 803
+  assign w804 = a & b; // padding line 804
+  assign w805 = a & b; // padding line 805
+  assign w806 = a & b; // padding line 806
+  assign w807 = a & b; // padding line 807
+  assign w808 = a & b; // padding line 808
+  assign w809 = a & b; // padding line 809
+  assign w810 = a & b; // padding line 810
+  assign w811 = a & b; // padding line 811
+  assign w812 = a & b; // padding line 812
+  assign w813 = a & b; // padding line 813
+  assign w814 = a & b; // padding line 814
+  assign w815 = a & b; // padding line 815
+  assign w816 = a & b; // padding line 816
+  assign w817 = a & b; // padding line 817
+  assign w818 = a & b; // padding line 818
+  assign w819 = a & b; // padding line 819
+  assign w820 = a & b; // padding line 820
+  assign w821 = a & b; // padding line 821
+  assign w822 = a & b; // padding line 822
+  assign w823 = a & b; // padding line 823
+  assign w824 = a & b; // padding line 824
+  assign w825 = a & b; // padding line 825
+  assign w826 = a & b; // padding line 826
+  assign w827 = a & b; // padding line 827
+  assign w828 = a & b; // padding line 828
+  assign w829 = a & b; // padding line 829
+  assign w830 = a & b; // padding line 830
+  assign w831 = a & b; // padding line 831
+  assign w832 = a & b; // padding line 832
+  assign w833 = a & b; // padding line 833
+  assign w834 = a & b; // padding line 834
+  assign w835 = a & b; // padding line 835
+  assign w836 = a & b; // padding line 836
+  assign w837 = a & b; // padding line 837
+  assign w838 = a & b; // padding line 838
+  assign w839 = a & b; // padding line 839
+  assign w840 = a & b; // padding line 840
+  assign w841 = a & b; // padding line 841
+  assign w842 = a & b; // padding line 842
+  assign w843 = a & b; // padding line 843
+  assign w844 = a & b; // padding line 844
+  assign w845 = a & b; // padding line 845
+  assign w846 = a & b; // padding line 846
+  assign w847 = a & b; // padding line 847
+  assign w848 = a & b; // padding line 848
+  assign w849 = a & b; // padding line 849
+  assign w850 = a & b; // padding line 850
+  assign w851 = a & b; // padding line 851
+  assign w852 = a & b; // padding line 852
+  assign w853 = a & b; // padding line 853
+  assign w854 = a & b; // padding line 854
+  assign w855 = a & b; // padding line 855
+  assign w856 = a & b; // padding line 856
+  assign w857 = a & b; // padding line 857
+  assign w858 = a & b; // padding line 858
+  assign w859 = a & b; // padding line 859
+  assign w860 = a & b; // padding line 860
+  assign w861 = a & b; // padding line 861
+  assign w862 = a & b; // padding line 862
+  assign w863 = a & b; // padding line 863
+  assign w864 = a & b; // padding line 864
+  assign w865 = a & b; // padding line 865
+  assign w866 = a & b; // padding line 866
+  assign w867 = a & b; // padding line 867
+  assign w868 = a & b; // padding line 868
+  assign w869 = a & b; // padding line 869
+  assign w870 = a & b; // padding line 870
+  assign w871 = a & b; // padding line 871
+  assign w872 = a & b; // padding line 872
+  assign w873 = a & b; // padding line 873
+  assign w874 = a & b; // padding line 874
+  assign w875 = a & b; // padding line 875
+  assign w876 = a & b; // padding line 876
+  assign w877 = a & b; // padding line 877
+  assign w878 = a & b; // padding line 878
+  assign w879 = a & b; // padding line 879
+  assign w880 = a & b; // padding line 880
+  assign w881 = a & b; // padding line 881
+  assign w882 = a & b; // padding line 882
+  assign w883 = a & b; // padding line 883
+  assign w884 = a & b; // padding line 884
+  assign w885 = a & b; // padding line 885
+  assign w886 = a & b; // padding line 886
+  assign w887 = a & b; // padding line 887
+  assign w888 = a & b; // padding line 888
+  assign w889 = a & b; // padding line 889
+  assign w890 = a & b; // padding line 890
+  assign w891 = a & b; // padding line 891
+  assign w892 = a & b; // padding line 892
+  assign w893 = a & b; // padding line 893
+  assign w894 = a & b; // padding line 894
+  assign w895 = a & b; // padding line 895
+  assign w896 = a & b; // padding line 896
+  assign w897 = a & b; // padding line 897
+  assign w898 = a & b; // padding line 898
+  assign w899 = a & b; // padding line 899
+  assign w900 = a & b; // padding line 900
+  assign w901 = a & b; // padding line 901
+  assign w902 = a & b; // padding line 902
+  assign w903 = a & b; // padding line 903
+  assign w904 = a & b; // padding line 904
+  assign w905 = a & b; // padding line 905
+  assign w906 = a & b; // padding line 906
+  assign w907 = a & b; // padding line 907
+  assign w908 = a & b; // padding line 908
+  assign w909 = a & b; // padding line 909
+  assign w910 = a & b; // padding line 910
+  assign w911 = a & b; // padding line 911
+  assign w912 = a & b; // padding line 912
+  assign w913 = a & b; // padding line 913
+  assign w914 = a & b; // padding line 914
+  assign w915 = a & b; // padding line 915
+  assign w916 = a & b; // padding line 916
+  assign w917 = a & b; // padding line 917
+  assign w918 = a & b; // padding line 918
+  assign w919 = a & b; // padding line 919
+  assign w920 = a & b; // padding line 920
+  assign w921 = a & b; // padding line 921
+  assign w922 = a & b; // padding line 922
+  assign w923 = a & b; // padding line 923
+  assign w924 = a & b; // padding line 924
+  assign w925 = a & b; // padding line 925
+  assign w926 = a & b; // padding line 926
+  assign w927 = a & b; // padding line 927
+  assign w928 = a & b; // padding line 928
+  assign w929 = a & b; // padding line 929
+  assign w930 = a & b; // padding line 930
+  assign w931 = a & b; // padding line 931
+  assign w932 = a & b; // padding line 932
+  assign w933 = a & b; // padding line 933
+  assign w934 = a & b; // padding line 934
+  assign w935 = a & b; // padding line 935
+  assign w936 = a & b; // padding line 936
+  assign w937 = a & b; // padding line 937
+  assign w938 = a & b; // padding line 938
+  assign w939 = a & b; // padding line 939
+  assign w940 = a & b; // padding line 940
+  assign w941 = a & b; // padding line 941
+  assign w942 = a & b; // padding line 942
+  assign w943 = a & b; // padding line 943
+  assign w944 = a & b; // padding line 944
+  assign w945 = a & b; // padding line 945
+  assign w946 = a & b; // padding line 946
+  assign w947 = a & b; // padding line 947
+  assign w948 = a & b; // padding line 948
+  assign w949 = a & b; // padding line 949
+  assign w950 = a & b; // padding line 950
+  assign w951 = a & b; // padding line 951
+  assign w952 = a & b; // padding line 952
+  assign w953 = a & b; // padding line 953
+  assign w954 = a & b; // padding line 954
+  assign w955 = a & b; // padding line 955
+  assign w956 = a & b; // padding line 956
+  assign w957 = a & b; // padding line 957
+  assign w958 = a & b; // padding line 958
+  assign w959 = a & b; // padding line 959
+  assign w960 = a & b; // padding line 960
+  assign w961 = a & b; // padding line 961
+  assign w962 = a & b; // padding line 962
+  assign w963 = a & b; // padding line 963
+  assign w964 = a & b; // padding line 964
+  assign w965 = a & b; // padding line 965
+  assign w966 = a & b; // padding line 966
+  assign w967 = a & b; // padding line 967
+  assign w968 = a & b; // padding line 968
+  assign w969 = a & b; // padding line 969
+  assign w970 = a & b; // padding line 970
+  assign w971 = a & b; // padding line 971
+  assign w972 = a & b; // padding line 972
+  assign w973 = a & b; // padding line 973
+  assign w974 = a & b; // padding line 974
+  assign w975 = a & b; // padding line 975
+  assign w976 = a & b; // padding line 976
+  assign w977 = a & b; // padding line 977
+  assign w978 = a & b; // padding line 978
+  assign w979 = a & b; // padding line 979
+  assign w980 = a & b; // padding line 980
+  assign w981 = a & b; // padding line 981
+  assign w982 = a & b; // padding line 982
+  assign w983 = a & b; // padding line 983
+  assign w984 = a & b; // padding line 984
+  assign w985 = a & b; // padding line 985
+  assign w986 = a & b; // padding line 986
+  assign w987 = a & b; // padding line 987
+  assign w988 = a & b; // padding line 988
+  assign w989 = a & b; // padding line 989
+  assign w990 = a & b; // padding line 990
+  assign w991 = a & b; // padding line 991
+  assign w992 = a & b; // padding line 992
+  assign w993 = a & b; // padding line 993
+  assign w994 = a & b; // padding line 994
+  assign w995 = a & b; // padding line 995
+  assign w996 = a & b; // padding line 996
+  assign w997 = a & b; // padding line 997
+  assign w998 = a & b; // padding line 998
+  assign w999 = a & b; // padding line 999
+  assign w1000 = a & b; // padding line 1000
+endmodule
@@ -0,0 +1,18 @@
+// Run with --cell-lib netlist_cells.json (or netlist_cells.lib)
+`timescale 1ns/1ps
+module netlist_top (clk, a, b, y, z);
+  input clk, a;
+  input [1:0] b;
+  output y, z;
+  wire n1, n2, n3, n4, floaty;
+  (* keep = 1 *)
+  AND2X1 u1 (.A(a), .B(b[0]), .Y(n1));
+  INVX1  u2 (.A(n1), .Y(y));
+  INVX1  u3 (.A(n1), .Y(y));      // second driver
+  AND2X1 u4 (.A(floaty), .B(n3), .Y(n2));
+  INVX1  u5 (.A(n2), .Y(n3));     // loop u4 -> u5 -> u4
+  DFFX1  r1 (.D(n2), .CK(clk), .Q(n4));
+  AND2X1 u6 (n4, b[1], z);        // positional
+  MYSTERY m1 (.P(n4), .Q());
+  assign n5 = n6, n6 = n5;        // assign loop
+endmodule
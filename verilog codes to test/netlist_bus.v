@@ -0,0 +1,15 @@
+// Run with --cell-lib netlist_cells.json: "n" and "d" are driven bit by bit or as a whole bus, and
+// "a [1]" / "d[ 1 ]" are spelled with spaces; only d[0] (driven by b0 and i4) is a real conflict
+module busnet (clk, a, y, z);
+  input clk;
+  input [1:0] a;
+  output y, z;
+  wire [1:0] n;
+  wire [1:0] d;
+  INVX1  i0 (.A(a[0]), .Y(n[0]));
+  INVX1  i1 (.A(a [1]), .Y(n[1]));
+  BUF2X1 b0 (.A(n), .Y(d));
+  INVX1  i2 (.A(d[0]), .Y(y));
+  INVX1  i3 (.A(d[ 1 ]), .Y(z));
+  INVX1  i4 (.A(a[0]), .Y(d [0]));  // second driver of d[0]
+endmodule
@@ -0,0 +1,6 @@
+// RTL wrapper made of assigns and an instance: stays in RTL mode even with --cell-lib
+module wrap(input [3:0] a, output [3:0] y, output z);
+    assign z = 1'bx;
+    assign y = a + 4'b1111;
+    sub u0(.a(a));
+endmodule
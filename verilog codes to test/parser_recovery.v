@@ -0,0 +1,14 @@
+// A stray endcase inside a begin/end block and a long else-if chain must not stall the RTL parser
+module parser_recovery (input [2:0] sel, input a, output reg y, output reg z);
+    always @* begin
+        y = a;
+        endcase
+    end
+    always @* begin
+        if (sel == 3'd0) z = 1'b0;
+        else if (sel == 3'd1) z = a;
+        else if (sel == 3'd2) z = ~a;
+        else if (sel == 3'd3) z = 1'b1;
+        else z = 1'b0;
+    end
+endmodule